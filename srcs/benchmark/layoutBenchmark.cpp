@@ -0,0 +1,205 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../flux/faceFluxes.hpp"
+
+
+/**
+ * \struct InterleavedLayout
+ * \brief Access to the nodal unknowns and physical fluxes packed node after node
+ * ([u, Fx, Fy] of each node are contiguous, 3*N values per node in 2D), such that
+ * the values read at one side of an edge lie in the same cache lines.
+ */
+template<unsigned short N>
+struct InterleavedLayout
+{
+    static constexpr unsigned int stride = 3*N; /**< Number of values per node */
+
+    const double* data;  /**< Packed values (see packInterleaved) */
+
+    /**
+     * \brief Unknown unk at a node.
+     */
+    double u(unsigned short unk, unsigned int node) const
+    {
+        return data[stride*node + unk];
+    }
+
+    /**
+     * \brief Component dim of the physical flux of the unknown unk at a node.
+     */
+    double flux(unsigned short dim, unsigned short unk, unsigned int node) const
+    {
+        return data[stride*node + N*(1 + dim) + unk];
+    }
+};
+
+
+/**
+ * \brief Pack the nodal unknowns and physical fluxes of a field node after node,
+ * for the interleaved layout.
+ * \param field Field containing the unknowns and the physical fluxes (2D).
+ * \param data Vector in which the values are packed (resized if needed).
+ */
+template<unsigned short N>
+static void packInterleaved(const Field& field, std::vector<double>& data)
+{
+    long numNodes = field.u[0].size();
+    data.resize(InterleavedLayout<N>::stride*numNodes);
+
+    #pragma omp parallel for default(none) shared(field, data, numNodes)
+    for(long node = 0 ; node < numNodes ; ++node)
+    {
+        double* packed = &data[InterleavedLayout<N>::stride*node];
+        for(unsigned short unk = 0 ; unk < N ; ++unk)
+        {
+            packed[unk] = field.u[unk][node];
+            packed[N + unk] = field.flux[0][unk][node];
+            packed[2*N + unk] = field.flux[1][unk][node];
+        }
+    }
+}
+
+/**
+ * \brief Build the face points of a synthetic mesh: a structured grid of
+ * triangles (3 nodes each, stored element after element), each element sharing
+ * an edge (2 face points) with its right and upper neighbours.
+ * \param nSide Number of elements along each side of the grid.
+ * \param solverMesh The flat mesh data in which the face points are stored.
+ */
+static void buildGrid(unsigned int nSide, SolverMesh& solverMesh)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> angle(0, 2*M_PI);
+
+    for(unsigned int i = 0 ; i < nSide ; ++i)
+    {
+        for(unsigned int j = 0 ; j < nSide ; ++j)
+        {
+            unsigned int elm = i*nSide + j;
+            unsigned int neighbours[2] = {i*nSide + (j + 1)%nSide,
+                                          ((i + 1)%nSide)*nSide + j};
+
+            for(unsigned int front : neighbours)
+            {
+                double theta = angle(generator);
+                unsigned int face = solverMesh.faceNormal.size()/2;
+                solverMesh.faceNormal.push_back(std::cos(theta));
+                solverMesh.faceNormal.push_back(std::sin(theta));
+
+                for(unsigned int a = 0 ; a < 2 ; ++a)
+                {
+                    solverMesh.pointFace.push_back(face);
+                    solverMesh.pointIndex.push_back(3*elm + a);
+                    solverMesh.pointIndex.push_back(3*front + 1 - a);
+                    solverMesh.pointBC.push_back(-1);
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ * \brief Time a function, returning the mean time of a call.
+ * \param nRepetitions Number of calls.
+ * \param func Function to time.
+ * \return Mean time of a call [ms].
+ */
+template<class Func>
+static double timeIt(unsigned int nRepetitions, Func func)
+{
+    func(); // warm-up
+    auto start = std::chrono::steady_clock::now();
+    for(unsigned int r = 0 ; r < nRepetitions ; ++r)
+        func();
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count()
+           /nRepetitions;
+}
+
+
+/**
+ * \brief Compare the split and interleaved layouts of the fields for the
+ * computation of the numerical (LF) fluxes of the shallow water equations.
+ * Usage: layoutBenchmark [number of elements along a side] [repetitions]
+ */
+int main(int argc, char **argv)
+{
+    unsigned int nSide = (argc > 1) ? std::atoi(argv[1]) : 500;
+    unsigned int nRepetitions = (argc > 2) ? std::atoi(argv[2]) : 20;
+    unsigned int numNodes = 3*nSide*nSide;
+
+    Mesh mesh;
+    buildGrid(nSide, mesh.solverMesh);
+    const SolverMesh& solverMesh = mesh.solverMesh;
+    unsigned int numPoints = solverMesh.pointFace.size();
+
+    SolverParams solverParams;
+    solverParams.nUnknowns = ShallowWater::nUnknowns;
+    solverParams.fluxCoeffs = {9.81};
+
+    // random (physical) state and its physical fluxes
+    Field field(numNodes, ShallowWater::nUnknowns, 2, numPoints, 3);
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> height(1, 2), speed(-1, 1);
+    for(unsigned int n = 0 ; n < numNodes ; ++n)
+    {
+        double u[3] = {height(generator), 0, 0};
+        u[1] = u[0]*speed(generator);
+        u[2] = u[0]*speed(generator);
+
+        double F[2][3];
+        ShallowWater::flux(u, F, solverParams.fluxCoeffs);
+        for(unsigned short unk = 0 ; unk < 3 ; ++unk)
+        {
+            field.u[unk][n] = u[unk];
+            field.flux[0][unk][n] = F[0][unk];
+            field.flux[1][unk][n] = F[1][unk];
+        }
+    }
+
+    std::cout << "Nodes: " << numNodes << ", face points: " << numPoints
+              << ", repetitions: " << nRepetitions << std::endl;
+
+    // split layout (the storage of Field)
+    double tSplit = timeIt(nRepetitions, [&]()
+    {
+        SplitLayout layout{field};
+        computeNumericalFluxes<ShallowWater, LF>(solverMesh, 2, layout, field, 0,
+                                                 solverParams);
+    });
+    std::vector<double> faceFluxSplit = field.faceFlux;
+
+    // interleaved layout, with and without packing the fields
+    std::vector<double> interleaved;
+    double tPack = timeIt(nRepetitions, [&]()
+    {
+        packInterleaved<3>(field, interleaved);
+    });
+
+    double tInterleaved = timeIt(nRepetitions, [&]()
+    {
+        InterleavedLayout<3> layout{interleaved.data()};
+        computeNumericalFluxes<ShallowWater, LF>(solverMesh, 2, layout, field, 0,
+                                                 solverParams);
+    });
+
+    // both layouts must give the same fluxes
+    double maxDiff = 0;
+    for(std::size_t i = 0 ; i < faceFluxSplit.size() ; ++i)
+        maxDiff = std::max(maxDiff, std::fabs(faceFluxSplit[i] - field.faceFlux[i]));
+
+    std::cout << "Split layout:                 " << tSplit << " ms" << std::endl
+              << "Interleaved layout:           " << tInterleaved << " ms"
+              << std::endl
+              << "Interleaved layout (+ pack):  " << tInterleaved + tPack << " ms"
+              << std::endl
+              << "Max difference of the fluxes: " << maxDiff << std::endl;
+
+    return (maxDiff == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -2,116 +2,119 @@
 #include <cmath>
 #include "buildFlux.hpp"
 #include <Eigen/Dense>
+#if defined(_OPENMP)
+    #include <omp.h>
+#endif
 
 
 // see .hpp file for description
-void buildFlux(const Mesh& mesh, Field& field, double factor, double t,
-               const SolverParams& solverParams)
+PartialField& getPartialField(Field& field)
 {
-    // loop over the elements
-    #pragma omp parallel for default(none) shared(field, mesh, solverParams, factor, t)
-    for(size_t elm = 0 ; elm < mesh.elements.size() ; elm++)
-    {
-        PartialField partialField(solverParams.nUnknowns, mesh.dim);
+    #if defined(_OPENMP)
+        return field.partialFields[omp_get_thread_num()];
+    #else
+        return field.partialFields[0];
+    #endif
+}
 
-        // local I vector for the current element
-        for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
-        {
-            partialField.partialIu[unk]
-                .resize(mesh.elementProperties
-                        .at(mesh.elements[elm].elementTypeHD).nSF);
-            partialField.partialIu[unk].setZero();
-        }
 
-        // loop over the edges for the current element
-        unsigned int nSigma = mesh.elements[elm].edges.size();
-        for(unsigned int s = 0 ; s < nSigma ; ++s)
+// see .hpp file for description
+void liftFluxes(const Mesh& mesh, const Field& field, PartialField& partialField,
+                std::size_t elm, double strongFactor)
+{
+    const SolverMesh& solverMesh = mesh.solverMesh;
+    unsigned int type = solverMesh.elmType[elm];
+    unsigned int nSF = solverMesh.typeNSF[type];
+    unsigned int nFaceNodes = solverMesh.typeFaceNodes[type];
+    const double* lift = &solverMesh.typeLift[solverMesh.typeLiftBegin[type]];
+    unsigned int offsetInU = solverMesh.elmOffsetInU[elm];
+    unsigned short nUnknowns = field.Iu.size();
+
+    // local I vector for the current element
+    for(unsigned short unk = 0 ; unk < nUnknowns ; ++unk)
+        partialField.partialIu[unk].head(nSF).setZero();
+
+    // loop over the edges for the current element
+    for(unsigned int f = solverMesh.elmFaceBegin[elm] ;
+        f < solverMesh.elmFaceBegin[elm + 1] ; ++f)
+    {
+        // current edge
+        const double* normal = &solverMesh.faceNormal[mesh.dim*f];
+        unsigned int firstNode = solverMesh.faceNodeBegin[f];
+
+        // normal flux at each node of the edge, the numerical flux being
+        // oriented along the normal of its face point
+        for(unsigned int a = 0 ; a < nFaceNodes ; ++a)
         {
-            // current edge
+            unsigned int n = firstNode + a;
+            const double* numFlux
+                = &field.faceFlux[nUnknowns*solverMesh.nodePoint[n]];
 
-            // we first compute the matrix-vector product of dM with gx and gy
-            for(unsigned short dim = 0 ; dim < mesh.dim ; ++dim)
+            for(unsigned short unk = 0 ; unk < nUnknowns ; ++unk)
             {
-                for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+                double gn = -solverMesh.nodeSign[n]*numFlux[unk];
+
+                if(strongFactor != 0)
                 {
-                        partialField.g[dim][unk]
-                            .resize(mesh.elementProperties
-                                    .at(mesh.elements[elm].elementTypeHD).nSF);
-                        partialField.g[dim][unk].setZero();
+                    unsigned int indexJ = offsetInU + solverMesh.nodeOffsetInElm[n];
+                    for(unsigned short dim = 0 ; dim < mesh.dim ; ++dim)
+                    {
+                        gn += strongFactor*normal[dim]
+                            *field.flux[dim][unk][indexJ];
+                    }
                 }
+
+                partialField.g[unk][a] = gn;
             }
+        }
 
-            for(unsigned int j = 0 ;
-                    j < mesh.elements[elm].edges[s].offsetInElm.size() ; ++j)
+        // lift of the normal fluxes with the (dense) face mass matrix
+        for(unsigned int a = 0 ; a < nFaceNodes ; ++a)
+        {
+            unsigned int offsetInElm = solverMesh.nodeOffsetInElm[firstNode + a];
+            for(unsigned short unk = 0 ; unk < nUnknowns ; ++unk)
             {
-                // global index of the current node
-                unsigned int indexJ = mesh.elements[elm].offsetInU
-                     + mesh.elements[elm].edges[s].offsetInElm[j];
+                double sum = 0;
+                for(unsigned int b = 0 ; b < nFaceNodes ; ++b)
+                    sum += lift[a*nFaceNodes + b]*partialField.g[unk][b];
 
-                // case of a boundary condition
-                if (mesh.elements[elm].edges[s].edgeInFront.first == -1)
-                {
-                    // compute the boundary condition
-                    ibc boundary = solverParams.boundaryConditions
-                            .at(mesh.elements[elm].edges[s].bcName);
+                partialField.partialIu[unk][offsetInElm]
+                    += solverMesh.faceDetLD[f]*sum;
+            }
+        }
+    }
+}
 
-                    boundary.ibcFunc(partialField.uAtBC,
-                            mesh.elements[elm].edges[s].nodeCoordinate[j], t,
-                            field, indexJ, mesh.elements[elm].edges[s].normal,
-                            boundary.coefficients, solverParams.fluxCoeffs);
 
-                    solverParams.flux(field, partialField, solverParams, true);
+// see .hpp file for description
+void buildFlux(const Mesh& mesh, Field& field, double factor, double t,
+               const SolverParams& solverParams)
+{
+    const SolverMesh& solverMesh = mesh.solverMesh;
 
-                    // compute the numerical flux
-                    // (the weak/strong form is stored in "factor")
-                    solverParams.phiPsi(mesh.elements[elm].edges[s], field,
-                        partialField, j, factor, true, indexJ, 0, solverParams);
-                }
-                else // general case
-                {
-                    // global index of the node "in front"
-                    unsigned int indexFrontJ =
-                                mesh
-                                    .elements[mesh.elements[elm].edges[s]
-                                        .edgeInFront.first].offsetInU
-                                + mesh
-                                    .elements[mesh.elements[elm].edges[s]
-                                                .edgeInFront.first]
-                                    .edges[mesh.elements[elm].edges[s]
-                                            .edgeInFront.second]
-                                    .offsetInElm[mesh.elements[elm]
-                                                    .edges[s]
-                                                    .nodeIndexEdgeInFront[j]];
-
-                    // compute the numerical flux
-                    // (the weak/strong form is stored in "factor")
-                    solverParams.phiPsi(mesh.elements[elm].edges[s], field,
-                        partialField, j, factor, false, indexJ,
-                        indexFrontJ, solverParams);
-                }
-            }
+    // first compute the numerical flux once at each face point
+    solverParams.numericalFluxes(mesh, field, t, solverParams);
 
-            // dot product between dM and the normal
-            for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
-            {
-                partialField.partialIu[unk] +=
-                    mesh.elements[elm].edges[s].determinantLD[0]*(
-                        mesh.elements[elm].edges[s].normal[0]*mesh
-                            .elements[elm].dM[s]*partialField.g[0][unk]
-                        + mesh.elements[elm].edges[s].normal[1]*mesh
-                            .elements[elm].dM[s]*partialField.g[1][unk]);
-            }
-        }
+    // the strong form also requires the physical flux of the element itself
+    // (factor is +1 for the weak form and -1 for the strong form)
+    double strongFactor = (1 - factor)/2;
+
+    // then gather them inside each element
+    #pragma omp parallel for default(none) shared(field, mesh, solverMesh, strongFactor)
+    for(size_t elm = 0 ; elm < solverMesh.elmType.size() ; elm++)
+    {
+        PartialField& partialField = getPartialField(field);
+        unsigned int nSF = solverMesh.typeNSF[solverMesh.elmType[elm]];
+        unsigned int offsetInU = solverMesh.elmOffsetInU[elm];
+
+        liftFluxes(mesh, field, partialField, elm, strongFactor);
 
         // add the local rhs vector to the global one
         for(unsigned short unk = 0 ; unk < field.Iu.size() ; ++unk)
         {
-            for(unsigned int j = 0 ;
-                j < mesh.elementProperties
-                    .at(mesh.elements[elm].elementTypeHD).nSF ; ++j)
+            for(unsigned int j = 0 ; j < nSF ; ++j)
             {
-                field.Iu[unk][mesh.elements[elm].offsetInU + j]
-                    = partialField.partialIu[unk][j];
+                field.Iu[unk][offsetInU + j] = partialField.partialIu[unk][j];
             }
         }
     }
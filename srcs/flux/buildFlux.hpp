@@ -6,6 +6,29 @@
 #include "../solver/field.hpp"
 
 
+/**
+ * \brief Get the flux workspace of the calling thread.
+ * \param field Structure containing the workspaces.
+ * \return The workspace of the thread.
+ */
+PartialField& getPartialField(Field& field);
+
+
+/**
+ * \brief Lift the numerical fluxes of the faces of an element into its local rhs
+ * (partialField.partialIu), once they are computed by
+ * SolverParams::numericalFluxes.
+ * \param mesh The mesh of the problem.
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param partialField Workspace of the calling thread.
+ * \param elm Index of the element.
+ * \param strongFactor 1 for the strong form (the physical flux of the element is
+ * subtracted from the numerical flux), 0 for the weak form.
+ */
+void liftFluxes(const Mesh& mesh, const Field& field, PartialField& partialField,
+                std::size_t elm, double strongFactor);
+
+
 /**
  * \brief Function that allows to build the rhs of the DG method.
  * \param mesh The mesh of the problem.
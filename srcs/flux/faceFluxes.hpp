@@ -0,0 +1,202 @@
+#ifndef faceFluxes_hpp
+#define faceFluxes_hpp
+
+#include "../mesh/Mesh.hpp"
+#include "../params/Params.hpp"
+#include "../solver/field.hpp"
+#include "../solver/fieldLayout.hpp"
+#include "../physics/numericalFluxes.hpp"
+#include "buildFlux.hpp"
+
+
+/**
+ * \brief Compute the numerical flux at one face point (in field.faceFlux),
+ * reading the unknowns and physical fluxes through a layout.
+ * \param solverMesh The flat data of the mesh.
+ * \param meshDim The dimension of the mesh.
+ * \param layout Access to the unknowns and physical fluxes (see fieldLayout.hpp).
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param partialField Workspace of the calling thread.
+ * \param p Index of the face point.
+ * \param t Current time of the simulation.
+ * \param solverParams Structure containing the solver's parameters.
+ */
+template<class Physics, template<class> class NumericalFlux, class Layout>
+inline void computePointFlux(const SolverMesh& solverMesh, unsigned short meshDim,
+                             const Layout& layout, Field& field,
+                             PartialField& partialField, std::size_t p, double t,
+                             const SolverParams& solverParams)
+{
+    constexpr unsigned short N = Physics::nUnknowns;
+
+    // global index of the current point on both sides of the edge
+    unsigned int indexJ = solverMesh.pointIndex[2*p];
+    unsigned int indexFrontJ = solverMesh.pointIndex[2*p + 1];
+
+    const double* normal = &solverMesh.faceNormal[meshDim*solverMesh.pointFace[p]];
+    double* numFlux = &field.faceFlux[N*p];
+
+    // unknowns and physical fluxes on both sides
+    double uIn[N], uOut[N], FIn[2][N], FOut[2][N];
+    for(unsigned short unk = 0 ; unk < N ; ++unk)
+    {
+        uIn[unk] = layout.u(unk, indexJ);
+        for(unsigned short dim = 0 ; dim < 2 ; ++dim)
+            FIn[dim][unk] = layout.flux(dim, unk, indexJ);
+    }
+
+    // case of a boundary condition
+    if(solverMesh.pointBC[p] != -1)
+    {
+        // compute the boundary condition
+        const ibc& boundary
+            = solverParams.meshBoundaryConditions[solverMesh.pointBC[p]];
+
+        boundary.ibcFunc(partialField.uAtBC, &solverMesh.pointCoord[3*p],
+                         t, field, indexJ, normal, boundary.coefficients,
+                         solverParams.fluxCoeffs);
+
+        for(unsigned short unk = 0 ; unk < N ; ++unk)
+            uOut[unk] = partialField.uAtBC[unk];
+
+        Physics::flux(uOut, FOut, solverParams.fluxCoeffs);
+    }
+    else // general case
+    {
+        for(unsigned short unk = 0 ; unk < N ; ++unk)
+        {
+            uOut[unk] = layout.u(unk, indexFrontJ);
+            for(unsigned short dim = 0 ; dim < 2 ; ++dim)
+                FOut[dim][unk] = layout.flux(dim, unk, indexFrontJ);
+        }
+    }
+
+    // compute the numerical flux
+    NumericalFlux<Physics>::compute(normal, uIn, uOut, FIn, FOut, numFlux,
+                                    solverParams.fluxCoeffs);
+}
+
+
+/**
+ * \brief Compute the numerical flux at each face point of the mesh (in
+ * field.faceFlux), reading the unknowns and physical fluxes through a layout.
+ * \param solverMesh The flat data of the mesh.
+ * \param meshDim The dimension of the mesh.
+ * \param layout Access to the unknowns and physical fluxes (see fieldLayout.hpp).
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param t Current time of the simulation.
+ * \param solverParams Structure containing the solver's parameters.
+ */
+template<class Physics, template<class> class NumericalFlux, class Layout>
+void computeNumericalFluxes(const SolverMesh& solverMesh, unsigned short meshDim,
+                            const Layout& layout, Field& field, double t,
+                            const SolverParams& solverParams)
+{
+    // the numerical flux is computed once at each face point, in a single
+    // stream over the face points tables
+    #pragma omp parallel default(none) \
+        shared(field, solverMesh, meshDim, layout, solverParams, t)
+    {
+        PartialField& partialField = getPartialField(field);
+
+        #pragma omp for
+        for(size_t p = 0 ; p < solverMesh.pointFace.size() ; ++p)
+        {
+            computePointFlux<Physics, NumericalFlux>(solverMesh, meshDim, layout,
+                                                     field, partialField, p, t,
+                                                     solverParams);
+        }
+    }
+}
+
+
+
+/**
+ * \brief Compute the numerical flux at each face point of the mesh (in
+ * field.faceFlux), from the solution and the physical fluxes. The kernel is
+ * instantiated for each physics and numerical flux, one of them being selected
+ * at startup (SolverParams::numericalFluxes).
+ * \param mesh The mesh of the problem.
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param t Current time of the simulation.
+ * \param solverParams Structure containing the solver's parameters.
+ */
+template<class Physics, template<class> class NumericalFlux>
+void buildNumericalFluxes(const Mesh& mesh, Field& field, double t,
+                          const SolverParams& solverParams)
+{
+    SplitLayout layout{field};
+    computeNumericalFluxes<Physics, NumericalFlux>(mesh.solverMesh, mesh.dim,
+                                                   layout, field, t, solverParams);
+}
+
+
+
+/**
+ * \brief Compute the physical fluxes at the nodes of some elements, then the
+ * numerical fluxes at some face points (for the local time stepping, see
+ * localTimeStepping.hpp).
+ * \param mesh The mesh of the problem.
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param t Current time of the simulation.
+ * \param solverParams Structure containing the solver's parameters.
+ * \param elements List of elements whose physical fluxes are computed.
+ * \param nElements Number of elements taken at the beginning of the list.
+ * \param points List of face points whose numerical fluxes are computed.
+ * \param nPoints Number of face points taken at the beginning of the list.
+ */
+template<class Physics, template<class> class NumericalFlux>
+void buildLocalFluxes(const Mesh& mesh, Field& field, double t,
+                      const SolverParams& solverParams,
+                      const std::vector<unsigned int>& elements,
+                      unsigned int nElements,
+                      const std::vector<unsigned int>& points,
+                      unsigned int nPoints)
+{
+    constexpr unsigned short N = Physics::nUnknowns;
+
+    const SolverMesh& solverMesh = mesh.solverMesh;
+    unsigned short meshDim = mesh.dim;
+    SplitLayout layout{field};
+
+    #pragma omp parallel default(none) \
+        shared(field, solverMesh, meshDim, layout, solverParams, t, elements, \
+               nElements, points, nPoints)
+    {
+        #pragma omp for
+        for(unsigned int e = 0 ; e < nElements ; ++e)
+        {
+            unsigned int elm = elements[e];
+            unsigned int offsetInU = solverMesh.elmOffsetInU[elm];
+            unsigned int nSF = solverMesh.typeNSF[solverMesh.elmType[elm]];
+
+            for(unsigned int j = offsetInU ; j < offsetInU + nSF ; ++j)
+            {
+                double u[N], F[2][N];
+                for(unsigned short unk = 0 ; unk < N ; ++unk)
+                    u[unk] = field.u[unk][j];
+
+                Physics::flux(u, F, solverParams.fluxCoeffs);
+
+                for(unsigned short unk = 0 ; unk < N ; ++unk)
+                {
+                    for(unsigned short dim = 0 ; dim < meshDim ; ++dim)
+                        field.flux[dim][unk][j] = F[dim][unk];
+                }
+            }
+        }
+
+        // the numerical fluxes require the physical fluxes of both sides
+        PartialField& partialField = getPartialField(field);
+
+        #pragma omp for
+        for(unsigned int i = 0 ; i < nPoints ; ++i)
+        {
+            computePointFlux<Physics, NumericalFlux>(solverMesh, meshDim, layout,
+                                                     field, partialField,
+                                                     points[i], t, solverParams);
+        }
+    }
+}
+
+#endif /* faceFluxes_hpp */
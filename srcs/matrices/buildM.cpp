@@ -2,80 +2,148 @@
 #include "buildM.hpp"
 
 
-// see .hpp file for description
-void buildM(const Mesh& mesh, Eigen::SparseMatrix<double>& invM)
+/**
+ * \brief Compute the inverse of the [M] matrix of an element.
+ * \param elmProp The properties of the element type.
+ * \param determinantHD The determinant of the variable change at each GP, or
+ * nullptr for the reference matrix (det[J] = 1).
+ * \param lu Workspace for the factorization of [M] (reused between elements).
+ * \param invM Pointer to the nSF x nSF (column major) inverse matrix, which is
+ * also used to assemble [M].
+ */
+static void computeInvM(const ElementProperty& elmProp, const double* determinantHD,
+                        Eigen::PartialPivLU<Eigen::MatrixXd>& lu, double* invM)
 {
+    // * prodFunc[k][i,j]: w_k*l_i*l_j evaluated at each GP
+    // * IJ[l]: components (i, j) for the index l that runs through the
+    //          upper-half part of [M]
+    const std::vector<std::vector<double>>& prodFunc = elmProp.prodFunc;
+    const std::vector<std::pair<unsigned int, unsigned int>>& IJ = elmProp.IJ;
 
-    // * index: vector of triplets that contains the coordinates in the [M] matrix
-    //          for each of its component
-    // * offsetMatrix: upper-left coordinate at which the current element matrix
-    //          should be added
-    std::vector<Eigen::Triplet<double>> index;
-    unsigned int offsetMatrix = 0;
+    // local [M] matrix for the current element
+    Eigen::Map<Eigen::MatrixXd> MLocal(invM, elmProp.nSF, elmProp.nSF);
 
-    // loop over the elements
-    for(size_t elm = 0 ; elm < mesh.elements.size() ; ++elm)
+    // construct the local [M] matrix
+    // since [M] is symmetric, we only loop over the upper-half matrix
+    for(unsigned int l = 0 ; l < elmProp.nSF*(elmProp.nSF+1)/2 ; ++l)
     {
-        // get the 2D properties of the current element type
-        // * prodFunc[k][i,j]: w_k*l_i*l_j evaluated at each GP
-        // * IJ[l]: components (i, j) for the index l that runs through the
-        //          upper-half part of [M]
-        ElementProperty elmProp
-            = mesh.elementProperties.at(mesh.elements[elm].elementTypeHD);
-        std::vector<std::vector<double>> prodFunc = elmProp.prodFunc;
-        std::vector<std::pair<unsigned int, unsigned int>> IJ = elmProp.IJ;
-
-        // local [M] matrix for the current element
-        Eigen::MatrixXd MLocal(elmProp.nSF, elmProp.nSF);
-        MLocal.setZero();
-
-        // construct the local [M] matrix
-        // since [M] is symmetric, we only loop over the upper-half matrix
-        for(unsigned int l = 0 ; l < elmProp.nSF*(elmProp.nSF+1)/2 ; ++l)
+
+        // sum over the GP
+        double sum = 0.0;
+        for(unsigned int k = 0 ; k < elmProp.nGP ; ++k)
         {
+            // M_ij = sum_k{w_k*l_i(x_k)*l_j(x_k)*det[J](x_k)}
+            sum += prodFunc[k][l]*(determinantHD ? determinantHD[k] : 1.0);
+        }
+
+        MLocal(IJ[l].first, IJ[l].second) = sum;
 
-            // sum over the GP
-            double sum = 0.0;
-            for(unsigned int k = 0 ; k < elmProp.nGP ; ++k)
-            {
-                // M_ij = sum_k{w_k*l_i(x_k)*l_j(x_k)*det[J](x_k)}
-                sum += prodFunc[k][l]*mesh.elements[elm].determinantHD[k];
-            }
-
-            MLocal(IJ[l].first, IJ[l].second) = sum;
-
-            // if we are not on the diagonal, we also add the lower-half matrix
-            if(IJ[l].first != IJ[l].second)
-            {
-                MLocal(IJ[l].second, IJ[l].first) = sum;
-            }
+        // if we are not on the diagonal, we also add the lower-half matrix
+        if(IJ[l].first != IJ[l].second)
+        {
+            MLocal(IJ[l].second, IJ[l].first) = sum;
         }
+    }
+
+    // inverse local M matrix (which is also symmetric)
+    lu.compute(MLocal);
+    MLocal = lu.inverse();
+}
+
 
-        // inverse local M matrix (which is also symmetric)
-        MLocal = MLocal.inverse();
+// see .hpp file for description
+void buildM(const Mesh& mesh, BlockDiagonalMatrix& invM)
+{
+    const SolverMesh& solverMesh = mesh.solverMesh;
+
+    // reference block of each element type, then a block for each non-affine
+    // element
+    std::vector<std::size_t> typeBegin;
+    std::size_t nValues = 0;
+    for(unsigned int type = 0 ; type < solverMesh.types.size() ; ++type)
+    {
+        typeBegin.push_back(nValues);
+        nValues += solverMesh.typeNSF[type]*solverMesh.typeNSF[type];
+    }
 
-        // set the indices for the global [M] matrix
-        for(unsigned int l = 0 ; l < elmProp.nSF*(elmProp.nSF+1)/2 ; ++l)
+    invM.elmBegin.resize(mesh.elements.size());
+    invM.elmScale.resize(mesh.elements.size());
+    for(size_t elm = 0 ; elm < mesh.elements.size() ; ++elm)
+    {
+        unsigned int type = solverMesh.elmType[elm];
+
+        if(solverMesh.elmAffine[elm])
+        {
+            // M = det[J]*M_ref, since the determinant is constant
+            invM.elmBegin[elm] = typeBegin[type];
+            invM.elmScale[elm] = 1.0/mesh.elements[elm].determinantHD[0];
+        }
+        else
         {
-            index.push_back(Eigen::Triplet<double>
-                (IJ[l].first + offsetMatrix,
-                    IJ[l].second + offsetMatrix,
-                    MLocal(IJ[l].first, IJ[l].second)));
-
-            // if we are not on the diagonal, we also add the lower-half matrix
-            if(IJ[l].first != IJ[l].second)
-            {
-                index.push_back(Eigen::Triplet<double>
-                    (IJ[l].second + offsetMatrix,
-                        IJ[l].first + offsetMatrix,
-                        MLocal(IJ[l].first, IJ[l].second)));
-            }
+            invM.elmBegin[elm] = nValues;
+            invM.elmScale[elm] = 1.0;
+            nValues += solverMesh.typeNSF[type]*solverMesh.typeNSF[type];
         }
+    }
+    invM.values.resize(nValues);
+
+    std::vector<const ElementProperty*> typeProp;
+    for(unsigned int type = 0 ; type < solverMesh.types.size() ; ++type)
+        typeProp.push_back(&mesh.elementProperties.at(solverMesh.types[type]));
+
+    #if defined(_OPENMP)
+        #pragma omp parallel default(none) shared(mesh, solverMesh, invM, typeBegin, typeProp)
+    #endif
+    {
+        Eigen::PartialPivLU<Eigen::MatrixXd> lu;
+
+        #if defined(_OPENMP)
+            #pragma omp for
+        #endif
+        for(unsigned int type = 0 ; type < typeProp.size() ; ++type)
+            computeInvM(*typeProp[type], nullptr, lu, &invM.values[typeBegin[type]]);
 
-        // increase the offset of the local matrix
-        offsetMatrix += elmProp.nSF;
+        // loop over the non-affine elements, each one writes its own block
+        #if defined(_OPENMP)
+            #pragma omp for schedule(dynamic, 256)
+        #endif
+        for(size_t elm = 0 ; elm < mesh.elements.size() ; ++elm)
+        {
+            if(solverMesh.elmAffine[elm])
+                continue;
+
+            computeInvM(*typeProp[solverMesh.elmType[elm]],
+                        mesh.elements[elm].determinantHD.data(), lu,
+                        &invM.values[invM.elmBegin[elm]]);
+        }
     }
+}
+
 
-    // add the triplets in the sparse matrix
-    invM.setFromTriplets(index.begin(), index.end());
+// see .hpp file for description
+void applyBlockDiagonal(const Mesh& mesh, const BlockDiagonalMatrix& A,
+                        const std::vector<Eigen::VectorXd>& x,
+                        std::vector<Eigen::VectorXd>& y)
+{
+    const SolverMesh& solverMesh = mesh.solverMesh;
+
+    #if defined(_OPENMP)
+        #pragma omp parallel for default(none) shared(solverMesh, A, x, y)
+    #endif
+    for(size_t elm = 0 ; elm < solverMesh.elmType.size() ; ++elm)
+    {
+        unsigned int nSF = solverMesh.typeNSF[solverMesh.elmType[elm]];
+        unsigned int offsetInU = solverMesh.elmOffsetInU[elm];
+
+        // the block is loaded once and applied to all the unknowns
+        Eigen::Map<const Eigen::MatrixXd> block(&A.values[A.elmBegin[elm]],
+                                                nSF, nSF);
+        double scale = A.elmScale[elm];
+
+        for(unsigned short unk = 0 ; unk < x.size() ; ++unk)
+        {
+            y[unk].segment(offsetInU, nSF).noalias()
+                = scale*(block*x[unk].segment(offsetInU, nSF));
+        }
+    }
 }
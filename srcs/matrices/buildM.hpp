@@ -1,9 +1,10 @@
 #ifndef buildM_hpp
 #define buildM_hpp
 
-#include <Eigen/Sparse>
+#include <vector>
 #include <Eigen/Dense>
 #include "../mesh/Mesh.hpp"
+#include "matrix.hpp"
 
 
 /**
@@ -11,10 +12,24 @@
  * defined as M_ij = sum_k{w_k*l_i(x_k)*l_j(x_k)*det[J](x_k)}, where the sum is done
  * over the Gauss points (GP). Since the components w_k*l_i(x_k)*l_j(x_k) are already
  * computed in the mesh, it suffices to get the determinant of the elements,
- * calculate this sum, and store the result in a sparse matrix.
+ * calculate this sum, and store the inverse of each element block.
  * \param mesh The structure that contains the mesh.
- * \param invM The Eigen::SparseMatrix in which the matrix components will be stored.
+ * \param invM The block diagonal matrix in which the inverse of [M] will be stored.
  */
-void buildM(const Mesh& mesh, Eigen::SparseMatrix<double>& invM);
+void buildM(const Mesh& mesh, BlockDiagonalMatrix& invM);
+
+
+/**
+ * \brief Multiply the vectors of all the unknowns by a block diagonal matrix,
+ * y[unk] = A*x[unk], element block after element block.
+ * \param mesh The structure that contains the mesh.
+ * \param A The block diagonal matrix.
+ * \param x The vectors to multiply (one per unknown).
+ * \param y The vectors in which the products are stored (one per unknown, of the
+ * same size as x, and different from x).
+ */
+void applyBlockDiagonal(const Mesh& mesh, const BlockDiagonalMatrix& A,
+                        const std::vector<Eigen::VectorXd>& x,
+                        std::vector<Eigen::VectorXd>& y);
 
 #endif /* buildM_hpp */
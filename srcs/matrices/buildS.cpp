@@ -3,85 +3,224 @@
 
 
 // see .hpp for description
-void buildS(const Mesh& mesh, Eigen::SparseMatrix<double>& Sx,
-            Eigen::SparseMatrix<double>& Sy)
+void buildS(const Mesh& mesh, VolumeOperator& S)
 {
-    // * indexx/indexy: vectors of triplets that contains the coordinates in the
-    //      [Sx]/[Sy] matrices of each ot their components
-    // * offsetMatrix: upper-left coordinate at which the current element matrix
-    //      should be added
-    std::vector<Eigen::Triplet<double>> indexx, indexy;
-    unsigned int offsetMatrix = 0;
-
-    // loop over the elements
-    for(size_t elm = 0 ; elm < mesh.elements.size() ; ++elm)
+    const SolverMesh& solverMesh = mesh.solverMesh;
+    S = VolumeOperator();
+
+    // reference operators of each element type
+    // * pondFunc[k][i]: w_k*l_i evaluated at each GP
+    for(unsigned int type = 0 ; type < solverMesh.types.size() ; ++type)
     {
-        // get the 2D properties of the current element type
-        // * pondFunc[k][i]: w_k*l_i evaluated at each GP
-        ElementProperty elmProp
-            = mesh.elementProperties.at(mesh.elements[elm].elementTypeHD);
-        std::vector<std::vector<double>> pondFunc = elmProp.pondFunc;
-
-        // matrices [Sx], [Sy] for the current element, the matrices are stored
-        // as vectors, such that S_{i,j} = [S](i*elmProp.nSF + j)
-        std::vector<double> sxElm(elmProp.nSF*elmProp.nSF, 0.0);
-        std::vector<double> syElm(elmProp.nSF*elmProp.nSF, 0.0);
-
-        // sum over the GP
+        const ElementProperty& elmProp
+            = mesh.elementProperties.at(solverMesh.types[type]);
+
+        S.typeNGP.push_back(elmProp.nGP);
+        S.typeBegin.push_back(S.pond.size());
+        S.typeRefBegin.push_back(S.ref.size());
+
+        for(unsigned int k = 0 ; k < elmProp.nGP ; ++k)
+        {
+            for(unsigned int j = 0 ; j < elmProp.nSF ; ++j)
+            {
+                // gradient of the shape functions
+                S.grad.push_back(elmProp.basisFuncGrad[k*elmProp.nSF*3 + j*3]);
+                S.grad.push_back(elmProp.basisFuncGrad[k*elmProp.nSF*3 + j*3 + 1]);
+            }
+
+            for(unsigned int i = 0 ; i < elmProp.nSF ; ++i)
+                S.pond.push_back(elmProp.pondFunc[k][i]);
+        }
+
+        // sum over the GP of the reference matrices (for affine elements)
+        S.ref.resize(S.ref.size() + 2*elmProp.nSF*elmProp.nSF, 0.0);
+        double* ref = &S.ref[S.typeRefBegin[type]];
         for(unsigned int k = 0 ; k < elmProp.nGP ; ++k)
+        {
+            for(unsigned int i = 0 ; i < elmProp.nSF ; ++i)
+            {
+                for(unsigned int j = 0 ; j < elmProp.nSF ; ++j)
+                {
+                    ref[2*(i*elmProp.nSF + j)] += elmProp.pondFunc[k][i]
+                        *elmProp.basisFuncGrad[k*elmProp.nSF*3 + j*3];
+                    ref[2*(i*elmProp.nSF + j) + 1] += elmProp.pondFunc[k][i]
+                        *elmProp.basisFuncGrad[k*elmProp.nSF*3 + j*3 + 1];
+                }
+            }
+        }
+    }
+
+    // metrics of each element at its GP (only at the first one for affine
+    // elements, since they are constant)
+    S.elmBegin.resize(mesh.elements.size() + 1, 0);
+    for(size_t elm = 0 ; elm < mesh.elements.size() ; ++elm)
+    {
+        unsigned int nGP = solverMesh.elmAffine[elm] ?
+                           1 : S.typeNGP[solverMesh.elmType[elm]];
+        S.elmBegin[elm + 1] = S.elmBegin[elm] + 4*nGP;
+    }
+    S.metrics.resize(S.elmBegin.back());
+
+    // each element writes its own metrics
+    #if defined(_OPENMP)
+        #pragma omp parallel for default(none) shared(mesh, S)
+    #endif
+    for(size_t elm = 0 ; elm < mesh.elements.size() ; ++elm)
+    {
+        const std::vector<double>& jacobianHD = mesh.elements[elm].jacobianHD;
+        double* metrics = &S.metrics[S.elmBegin[elm]];
+
+        for(unsigned int k = 0 ; k < (S.elmBegin[elm + 1] - S.elmBegin[elm])/4 ; ++k)
         {
             // only the 2D case here
-            double dxdxi    = mesh.elements[elm].jacobianHD[9*k];
-            double dxdeta   = mesh.elements[elm].jacobianHD[9*k + 3];
-            double dydxi    = mesh.elements[elm].jacobianHD[9*k + 1];
-            double dydeta   = mesh.elements[elm].jacobianHD[9*k + 4];
+            double dxdxi    = jacobianHD[9*k];
+            double dxdeta   = jacobianHD[9*k + 3];
+            double dydxi    = jacobianHD[9*k + 1];
+            double dydeta   = jacobianHD[9*k + 4];
 
             // dzdzeta component of the jacobian: +/-1
-            double sign = mesh.elements[elm].jacobianHD[9*k + 8];
+            double sign = jacobianHD[9*k + 8];
 
             // the dets simplify in the inverse of a 2x2 matrix !
-            double dxidx    = dydeta/sign;
-            double detadx   = - dydxi/sign;
-            double dxidy    = - dxdeta/sign;
-            double detady   = dxdxi/sign;
+            metrics[4*k]        = dydeta/sign;      // dxi/dx
+            metrics[4*k + 1]    = - dydxi/sign;     // deta/dx
+            metrics[4*k + 2]    = - dxdeta/sign;    // dxi/dy
+            metrics[4*k + 3]    = dxdxi/sign;       // deta/dy
+        }
+    }
+}
 
-            // loop over the components of the matrix
-            for(unsigned int i = 0 ; i < elmProp.nSF ; ++i)
+
+/**
+ * \brief Add the volume term of an affine element to the right-hand side, using
+ * the reference matrices of its type: [Sx] = dxi/dx*[Sxi] + deta/dx*[Seta] and
+ * [Sy] = dxi/dy*[Sxi] + deta/dy*[Seta] (times det[J]).
+ * \param ref Reference matrices [Sxi], [Seta] of the element type.
+ * \param metrics Metrics of the element.
+ * \param nSF Number of shape functions of the element.
+ * \param fx Physical flux along x at the nodes of the element.
+ * \param fy Physical flux along y at the nodes of the element.
+ * \param Iu Right-hand side at the nodes of the element.
+ * \param weak true for the weak form, false for the strong form.
+ */
+static void applyAffineS(const double* ref, const double* metrics, unsigned int nSF,
+                         const double* fx, const double* fy, double* Iu, bool weak)
+{
+    if(weak)
+    {
+        // Iu_j += sum_i{Sxi_ij*(dxi/dx*fx_i + dxi/dy*fy_i)
+        //              + Seta_ij*(deta/dx*fx_i + deta/dy*fy_i)}
+        for(unsigned int i = 0 ; i < nSF ; ++i)
+        {
+            double fxi  = metrics[0]*fx[i] + metrics[2]*fy[i];
+            double feta = metrics[1]*fx[i] + metrics[3]*fy[i];
+            const double* refI = &ref[2*i*nSF];
+            for(unsigned int j = 0 ; j < nSF ; ++j)
+                Iu[j] += refI[2*j]*fxi + refI[2*j + 1]*feta;
+        }
+    }
+    else
+    {
+        // Iu_i -= sum_j{Sxi_ij*(dxi/dx*fx_j + dxi/dy*fy_j)
+        //              + Seta_ij*(deta/dx*fx_j + deta/dy*fy_j)}
+        for(unsigned int i = 0 ; i < nSF ; ++i)
+        {
+            double dfxdxi = 0.0, dfxdeta = 0.0, dfydxi = 0.0, dfydeta = 0.0;
+            const double* refI = &ref[2*i*nSF];
+            for(unsigned int j = 0 ; j < nSF ; ++j)
             {
-                for(unsigned int j = 0 ; j < elmProp.nSF ; ++j)
-                {
+                dfxdxi  += refI[2*j]*fx[j];
+                dfxdeta += refI[2*j + 1]*fx[j];
+                dfydxi  += refI[2*j]*fy[j];
+                dfydeta += refI[2*j + 1]*fy[j];
+            }
 
-                    // gradient of the shape functions
-                    double dljdxi = elmProp.basisFuncGrad
-                        [k*elmProp.nSF*3 + j*3];
-                    double dljdeta = elmProp.basisFuncGrad
-                        [k*elmProp.nSF*3 + j*3 + 1];
-
-                    // components of the elements
-                    sxElm[i*elmProp.nSF + j]
-                        += pondFunc[k][i]*(dljdxi*dxidx + dljdeta*detadx);
-                    syElm[i*elmProp.nSF + j]
-                        += pondFunc[k][i]*(dljdxi*dxidy + dljdeta*detady);
-
-                    // if we have calculated the sum for all the GP,
-                    // we can save the computed components
-                    if(k == elmProp.nGP - 1)
-                    {
-                        indexx.push_back(Eigen::Triplet<double>
-                            (i + offsetMatrix, j + offsetMatrix,
-                                sxElm[i*elmProp.nSF + j]));
-
-                        indexy.push_back(Eigen::Triplet<double>
-                            (i + offsetMatrix, j + offsetMatrix,
-                                syElm[i*elmProp.nSF + j]));
-                    }
-                }
+            Iu[i] -= metrics[0]*dfxdxi + metrics[1]*dfxdeta
+                   + metrics[2]*dfydxi + metrics[3]*dfydeta;
+        }
+    }
+}
+
+
+// see .hpp for description
+void applyElementS(const SolverMesh& solverMesh, const VolumeOperator& S,
+                   std::size_t elm, const double* fx, const double* fy, double* Iu,
+                   bool weak)
+{
+    unsigned int type = solverMesh.elmType[elm];
+    unsigned int nSF = solverMesh.typeNSF[type];
+    const double* metrics = &S.metrics[S.elmBegin[elm]];
+
+    if(solverMesh.elmAffine[elm])
+    {
+        applyAffineS(&S.ref[S.typeRefBegin[type]], metrics, nSF, fx, fy, Iu, weak);
+        return;
+    }
+
+    const double* grad = &S.grad[2*S.typeBegin[type]];
+    const double* pond = &S.pond[S.typeBegin[type]];
+
+    // sum over the GP
+    for(unsigned int k = 0 ; k < S.typeNGP[type] ; ++k)
+    {
+        const double* gradK = &grad[2*k*nSF];
+        const double* pondK = &pond[k*nSF];
+        const double* metricsK = &metrics[4*k];
+
+        if(weak)
+        {
+            // Iu_j += sum_k{(dl_j/dx*fx + dl_j/dy*fy)*w_k*det[J]}(x_k)
+            double fxK = 0.0, fyK = 0.0;
+            for(unsigned int i = 0 ; i < nSF ; ++i)
+            {
+                fxK += pondK[i]*fx[i];
+                fyK += pondK[i]*fy[i];
+            }
+
+            double dxi  = metricsK[0]*fxK + metricsK[2]*fyK;
+            double deta = metricsK[1]*fxK + metricsK[3]*fyK;
+            for(unsigned int j = 0 ; j < nSF ; ++j)
+                Iu[j] += gradK[2*j]*dxi + gradK[2*j + 1]*deta;
+        }
+        else
+        {
+            // Iu_i -= sum_k{w_k*l_i*(dfx/dx + dfy/dy)*det[J]}(x_k)
+            double dfxdxi = 0.0, dfxdeta = 0.0, dfydxi = 0.0, dfydeta = 0.0;
+            for(unsigned int j = 0 ; j < nSF ; ++j)
+            {
+                dfxdxi  += gradK[2*j]*fx[j];
+                dfxdeta += gradK[2*j + 1]*fx[j];
+                dfydxi  += gradK[2*j]*fy[j];
+                dfydeta += gradK[2*j + 1]*fy[j];
             }
+
+            double divF = metricsK[0]*dfxdxi + metricsK[1]*dfxdeta
+                        + metricsK[2]*dfydxi + metricsK[3]*dfydeta;
+            for(unsigned int i = 0 ; i < nSF ; ++i)
+                Iu[i] -= pondK[i]*divF;
+        }
+    }
+}
+
+
+// see .hpp for description
+void applyS(const Mesh& mesh, const VolumeOperator& S, Field& field, bool weak)
+{
+    const SolverMesh& solverMesh = mesh.solverMesh;
+
+    #if defined(_OPENMP)
+        #pragma omp parallel for default(none) shared(solverMesh, S, field, weak)
+    #endif
+    for(size_t elm = 0 ; elm < solverMesh.elmType.size() ; ++elm)
+    {
+        unsigned int offsetInU = solverMesh.elmOffsetInU[elm];
+
+        for(unsigned short unk = 0 ; unk < field.Iu.size() ; ++unk)
+        {
+            applyElementS(solverMesh, S, elm,
+                          field.flux[0][unk].data() + offsetInU,
+                          field.flux[1][unk].data() + offsetInU,
+                          field.Iu[unk].data() + offsetInU, weak);
         }
-        // increase the offset of the local matrix
-        offsetMatrix += elmProp.nSF;
     }
-    // add the triplets in the sparse matrix
-    Sx.setFromTriplets(indexx.begin(), indexx.end());
-    Sy.setFromTriplets(indexy.begin(), indexy.end());
 }
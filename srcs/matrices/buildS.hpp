@@ -1,8 +1,9 @@
 #ifndef buildS_hpp
 #define buildS_hpp
 
-#include <Eigen/Sparse>
 #include "../mesh/Mesh.hpp"
+#include "../solver/field.hpp"
+#include "matrix.hpp"
 
 
 /**
@@ -12,17 +13,43 @@
  *						+ dl_j/deta(x_k)*deta/dx(x_k)]*det[J](x_k)}, and
  $ sum_k{w_k*l_i(x_k)*[dl_j/dxi(x_k)*dxi/dy(x_k)
  *						+ dl_j/deta(x_k)*deta/dy(x_k)]*det[J](x_k)}, where the
- * sum is done over the Gauss points (GP). Since the components w_k*l_i(x_k) are
- * already computed in the mesh, it suffices to compute the components of the inverse
- * change of variable between the reference and physical frame (the dX/dx), to
- * calculate the sum, and store the result in a sparse matrix.
+ * sum is done over the Gauss points (GP). The matrices are not assembled: the
+ * components w_k*l_i(x_k) and dl_j/dxi(x_k), dl_j/deta(x_k) are stored once per
+ * element type, and the components of the inverse change of variable between the
+ * reference and physical frame (the dX/dx, times det[J]) once per GP of each
+ * element, such that the sum is computed on the fly by applyS.
  * \param mesh The structure that contains the mesh.
- * \param Sx The Eigen::SparseMatrix in which the matrix [Sx] components will be
- * stored.
- * \param Sy The Eigen::SparseMatrix in which the matrix [Sx] components will be
- * stored.
+ * \param S The structure in which the operators will be stored.
  */
-void buildS(const Mesh& mesh, Eigen::SparseMatrix<double>& Sx,
-	Eigen::SparseMatrix<double>& Sy);
+void buildS(const Mesh& mesh, VolumeOperator& S);
+
+
+/**
+ * \brief Add the volume term of one element, for one unknown, to its right-hand
+ * side (see applyS).
+ * \param solverMesh The flat data of the mesh.
+ * \param S The operators built by buildS.
+ * \param elm Index of the element.
+ * \param fx Physical flux along x at the nodes of the element.
+ * \param fy Physical flux along y at the nodes of the element.
+ * \param Iu Right-hand side at the nodes of the element.
+ * \param weak true for the weak form, false for the strong form.
+ */
+void applyElementS(const SolverMesh& solverMesh, const VolumeOperator& S,
+                   std::size_t elm, const double* fx, const double* fy, double* Iu,
+                   bool weak);
+
+
+/**
+ * \brief Add the volume term of the DG method to the right-hand side field.Iu,
+ * without assembling [Sx], [Sy]: Iu -= [Sx]*fx + [Sy]*fy for the strong form, and
+ * Iu += [Sx]^T*fx + [Sy]^T*fy for the weak form, fx and fy being the nodal
+ * physical fluxes.
+ * \param mesh The structure that contains the mesh.
+ * \param S The operators built by buildS.
+ * \param field Structure that contains all the main variables.
+ * \param weak true for the weak form, false for the strong form.
+ */
+void applyS(const Mesh& mesh, const VolumeOperator& S, Field& field, bool weak);
 
 #endif /* buildS_hpp */
@@ -1,7 +1,57 @@
 #ifndef matrix_hpp_included
 #define matrix_hpp_included
 
-#include <Eigen/Sparse>
+#include <cstddef>
+#include <vector>
+
+/**
+ * \struct VolumeOperator
+ * \brief Matrix-free form of the [Sx], [Sy] matrices: reference operators of each
+ * element type and metrics of the variable change of each element at its GP. The
+ * metrics of affine elements are constant: they are only stored once, and their
+ * matrices are combinations of the reference matrices [Sxi], [Seta].
+ */
+struct VolumeOperator
+{
+    std::vector<unsigned int> typeNGP;  /**< Number of GP of each element type id */
+    std::vector<unsigned int> typeBegin;/**< Index of the operators of each element
+                                            type id in pond (2x this in grad) */
+    std::vector<double> grad;           /**< dl_j/dxi, dl_j/deta at each GP k
+                                            (grad[2*(k*nSF + j) + 0/1]) */
+    std::vector<double> pond;           /**< w_k*l_i at each GP k
+                                            (pond[k*nSF + i]) */
+    std::vector<unsigned int> typeRefBegin; /**< Index of the reference matrices
+                                                of each element type id in ref */
+    std::vector<double> ref;            /**< Sxi_ij = sum_k{w_k*l_i*dl_j/dxi},
+                                            Seta_ij = sum_k{w_k*l_i*dl_j/deta}
+                                            (ref[2*(i*nSF + j) + 0/1]) */
+
+    std::vector<unsigned int> elmBegin; /**< Index of the metrics of each element
+                                            (size: nElements + 1) */
+    std::vector<double> metrics;        /**< det[J]*dxi/dx, det[J]*deta/dx,
+                                            det[J]*dxi/dy, det[J]*deta/dy at each
+                                            GP of each element (only at the first
+                                            GP for affine elements) */
+};
+
+/**
+ * \struct BlockDiagonalMatrix
+ * \brief Block diagonal matrix, with one dense nSF x nSF block per element (the
+ * rows and columns of the block of an element are those of its unknowns). The
+ * block of an element is a stored block times a scale factor, such that affine
+ * elements share the reference block of their type.
+ */
+struct BlockDiagonalMatrix
+{
+    std::vector<std::size_t> elmBegin;  /**< Index of the stored block of each
+                                            element in values */
+    std::vector<double> elmScale;       /**< Scale factor of the block of each
+                                            element */
+    std::vector<double> values;         /**< Stored blocks (reference block of
+                                            each element type, then the ones of
+                                            the non-affine elements), contiguous
+                                            and column major */
+};
 
 /**
  * \struct Matrix
@@ -10,9 +60,8 @@
 struct Matrix
 {
 
-	Eigen::SparseMatrix<double> invM;   /**< Inverse of the mass matrix */
-	Eigen::SparseMatrix<double> Sx;     /**< X-stiffness matrix */
-	Eigen::SparseMatrix<double> Sy;     /**< Y-stiffness matrix */
+	BlockDiagonalMatrix invM;           /**< Inverse of the mass matrix */
+	VolumeOperator S;                   /**< Stiffness matrices [Sx], [Sy] */
 };
 
 #endif
@@ -4,10 +4,14 @@
  */
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <fstream>
+#include <unordered_map>
 #include <gmsh.h>
 #include "Mesh.hpp"
+#include "meshCache.hpp"
 #include "../utils/utils.hpp"
 
 
@@ -47,6 +51,30 @@ static void loadNodeData(Mesh& mesh)
 }
 
 
+/**
+ * \brief Load the coordinates of all the nodes of the model in a single call.
+ * \param nodesCoord Vector in which the coordinates (x, y, z) of the node of tag
+ * n are stored at index 3*n.
+ */
+static void loadNodesCoord(std::vector<double>& nodesCoord)
+{
+    std::vector<std::size_t> nodeTags;
+    std::vector<double> coord, dummyParametricCoord;
+    gmsh::model::mesh::getNodes(nodeTags, coord, dummyParametricCoord);
+
+    std::size_t maxTag = 0;
+    for(std::size_t nodeTag : nodeTags)
+        maxTag = std::max(maxTag, nodeTag);
+
+    nodesCoord.assign(3*(maxTag + 1), 0.0);
+    for(std::size_t n = 0 ; n < nodeTags.size() ; ++n)
+    {
+        for(unsigned short i = 0 ; i < 3 ; ++i)
+            nodesCoord[3*nodeTags[n] + i] = coord[3*n + i];
+    }
+}
+
+
 /**
  * \brief Loads the name order, dimension, number of nodes,
  *  basis functions, integration points for a certain element type into a map.
@@ -194,18 +222,19 @@ static void addEdge(Element& element, std::vector<int> nodesTagsEdge,
  * \param edge The edge of which the normal is computed.
  * \param meshDim Dimension of the mesh (1 or 2)
  * \param baryCenter  Barycenter of the parent element.
+ * \param nodesCoord Coordinates of the nodes of the mesh, indexed by node tag.
  */
 static void computeEdgeNormalCoord(Edge& edge, unsigned int meshDim,
-                              const std::vector<double>& baryCenter)
+                              const std::vector<double>& baryCenter,
+                              const std::vector<double>& nodesCoord)
 {
     std::vector<double> normal;
 
     std::vector<double> coord1, coord2;
     for(unsigned int i = 0 ; i < edge.nodeTags.size() ; ++i)
     {
-            std::vector<double> coord, dummyParametricCoord;
-            gmsh::model::mesh::getNode(edge.nodeTags[i], coord,
-                                        dummyParametricCoord);
+            std::vector<double> coord(nodesCoord.begin() + 3*edge.nodeTags[i],
+                                      nodesCoord.begin() + 3*(edge.nodeTags[i] + 1));
 
             edge.nodeCoordinate.push_back(coord);
 
@@ -261,80 +290,39 @@ static void computeEdgeNormalCoord(Edge& edge, unsigned int meshDim,
 }
 
 /**
- * \brief Find the second position of the edge in the entity.
- * \param entity The parent entity.
- * \param currentEdge The edge of which you want to find the neighbor.
- * \param edgePos Index of the edge in its element.
+ * \brief Check if an edge lies on a boundary (and which one)
+ * \param mesh The mesh which stores the boundaries of each boundary node.
+ * \param edge The edge which we check if it is a boundary.
  */
-static void findInFrontEdge(Mesh& mesh, Edge& currentEdge, unsigned int edgePos)
+static bool IsBoundary(const Mesh& mesh, Edge& edge)
 {
-    // try to find the edge in another element. If an edge is not a boundary, then
-    // it has necessarily an "edge in front", which will be found
-    // (the check is done an all previously computed elements).
-    unsigned int elVecSize = mesh.elements.size();
-    unsigned int nEdgePerEl = mesh.elements[0].edges.size();
+    // an edge belongs to a boundary if all its nodes belong to it, the candidates
+    // are thus the boundaries of its first node
+    auto firstNode = mesh.nodesBoundary.find(edge.nodeTags[0]);
+    if(firstNode == mesh.nodesBoundary.end())
+        return false;
 
-    #pragma omp parallel default(none) shared(mesh, elVecSize, nEdgePerEl, currentEdge, edgePos)
+    for(unsigned int bc : firstNode->second)
     {
-        #pragma omp for
-        for(unsigned int elm = 0 ; elm < elVecSize ; ++elm)
+        bool inBoundary = true;
+        for(unsigned int j = 1 ; j < edge.nodeTags.size() ; ++j)
         {
-            for(unsigned int k = 0 ; k < nEdgePerEl ; ++k)
+            auto node = mesh.nodesBoundary.find(edge.nodeTags[j]);
+            if(node == mesh.nodesBoundary.end())
+                return false;
+
+            if(!std::binary_search(node->second.begin(), node->second.end(), bc))
             {
-                std::vector<int> nodesTagsInfront
-                    = mesh.elements[elm].edges[k].nodeTags;
-                std::vector<unsigned int> permutation1, permutation2;
-
-                // if the nodes tags of an edge is the permutation of the nodes tags
-                //  of another, we have found the "edge in front"
-                if(isPermutation(currentEdge.nodeTags, nodesTagsInfront,
-                                    permutation1, permutation2))
-                {
-                    #pragma omp critical
-                    {
-                        currentEdge.edgeInFront
-                            =  std::pair<unsigned int, unsigned int>(elm, k);
-                        mesh.elements[elm].edges[k].edgeInFront
-                            = std::pair<unsigned int, unsigned int>
-                            (elVecSize, edgePos);
-                        currentEdge.nodeIndexEdgeInFront = std::move(permutation1);
-                        mesh.elements[elm].edges[k].nodeIndexEdgeInFront
-                            = std::move(permutation2);
-                    }
-                    #pragma omp cancel for
-                }
+                inBoundary = false;
+                break;
             }
-            #pragma omp cancellation point for
         }
-    }
-}
 
-/**
- * \brief Check if an edge lies on a boundary (and which one)
- * \param nodesTagBoundaries Map which stores the tags of the nodes belonging to a
- *  certain boundary.
- * \param edge The edge which we check if it is a boundary.
- */
-static bool IsBoundary(const std::map<std::string,
-                            std::vector<std::size_t>>& nodesTagBoundaries, Edge& edge)
-{
-    // check if an edge is on the boundary of the domain.
-    for(std::pair<std::string, std::vector<std::size_t>> nodeTagBoundary : nodesTagBoundaries)
-    {
-        for(unsigned int j = 0 ; j < edge.nodeTags.size() ; ++j)
+        // ok the edge belongs to that boundary.
+        if(inBoundary)
         {
-            // if one of the nodes tags of the edge is not found inside the boundary
-            // then the edge does not belong to that boundary
-            if(!std::count(nodeTagBoundary.second.begin(),
-                            nodeTagBoundary.second.end(), edge.nodeTags[j]))
-                break;
-
-            // ok the edge belongs to that boundary.
-            if(j == edge.nodeTags.size() - 1)
-            {
-                edge.bcName = nodeTagBoundary.first;
-                return true;
-            }
+            edge.bcName = mesh.bcNames[bc];
+            return true;
         }
     }
     return false;
@@ -358,6 +346,7 @@ static bool IsBoundary(const std::map<std::string,
  * \param nodesTagsPerEdge Node tags of the element, per edge.
  * \param nodesTags Node tags of the element.
  * \param elementBarycenter Element barycenter coordinate.
+ * \param nodesCoord Coordinates of the nodes of the mesh, indexed by node tag.
  */
 static void addElement(Mesh& mesh, int elementTag, int eleTypeHD,
                         int eleTypeLD, std::vector<double> jacobiansHD,
@@ -366,7 +355,8 @@ static void addElement(Mesh& mesh, int elementTag, int eleTypeHD,
                         unsigned int nGPLD, unsigned int offsetInU,
                         std::vector<int> nodesTagsPerEdge,
                         std::vector<int> nodesTags,
-                        const std::vector<double>& elementBarycenter)
+                        const std::vector<double>& elementBarycenter,
+                        const std::vector<double>& nodesCoord)
 {
     // fill an element structure
     Element element;
@@ -382,10 +372,9 @@ static void addElement(Mesh& mesh, int elementTag, int eleTypeHD,
 
     for(unsigned int i = 0 ; i < element.nodeTags.size() ; ++i)
     {
-        std::vector<double> coord, dummyParametricCoord;
-        gmsh::model::mesh::getNode(element.nodeTags[i], coord, dummyParametricCoord);
-
-        element.nodesCoord.push_back(coord);
+        element.nodesCoord.push_back(std::vector<double>(
+                                nodesCoord.begin() + 3*element.nodeTags[i],
+                                nodesCoord.begin() + 3*(element.nodeTags[i] + 1)));
     }
 
     // compute the number of edge and of nodes per edge of that element
@@ -408,43 +397,212 @@ static void addElement(Mesh& mesh, int elementTag, int eleTypeHD,
         // add the edge to the element.edges field
         addEdge(element, std::move(nodesTagsEdge), std::move(determinantsEdgeLD),
                     element.nodeTags);
-        if(mesh.elements.size() != 0)
+
+        // check if the edge is on the boundary of the domain (the neighbours of
+        // the other edges are found once all the elements are added)
+        IsBoundary(mesh, element.edges[i]);
+
+        // compute the normal of the edge and get the nodes coordinates of the edge
+        computeEdgeNormalCoord(element.edges[i], mesh.dim, elementBarycenter,
+                               nodesCoord);
+    }
+
+    // add the element to the mesh
+    mesh.elements.push_back(element);
+}
+
+
+/**
+ * \brief Check if the variable change of an element is affine, i.e. if its
+ * Jacobian is the same at each Gauss point.
+ * \param element The element (with its jacobianHD).
+ * \return true if the element is affine.
+ */
+static bool isAffine(const Element& element)
+{
+    const std::vector<double>& jacobian = element.jacobianHD;
+
+    double scale = 0.0;
+    for(unsigned int c = 0 ; c < 9 ; ++c)
+        scale = std::max(scale, std::abs(jacobian[c]));
+
+    for(std::size_t c = 9 ; c < jacobian.size() ; ++c)
+    {
+        if(std::abs(jacobian[c] - jacobian[c%9]) > 1e-12*scale)
+            return false;
+    }
+
+    return true;
+}
+
+
+/**
+ * \brief Compute the characteristic length of an element for the CFL condition,
+ * 2*|K|/|dK| (the length in 1D, the radius of the inscribed circle for a
+ * triangle) divided by 2p + 1.
+ * \param element The element (with its determinantHD and edges).
+ * \param elmProp The properties of the element type.
+ * \param meshDim The dimension of the mesh.
+ * \return The characteristic length.
+ */
+static double elementLength(const Element& element,
+                            const ElementProperty& elmProp,
+                            unsigned short meshDim)
+{
+    double volume = 0.0;
+    for(unsigned int k = 0 ; k < elmProp.nGP ; ++k)
+        volume += elmProp.intWeigths[k]*element.determinantHD[k];
+
+    // in 1D, the faces are points of unit measure
+    double boundary = 0.0;
+    for(const Edge& edge : element.edges)
+        boundary += (meshDim == 1) ? 1.0 : edge.length;
+
+    return 2*std::abs(volume)/(boundary*(2*elmProp.order + 1));
+}
+
+
+/**
+ * \brief Build the flat solver data of a mesh from its elements and edges.
+ * \param mesh The mesh whose solverMesh is built.
+ */
+static void buildSolverMesh(Mesh& mesh)
+{
+    SolverMesh& solverMesh = mesh.solverMesh;
+    solverMesh = SolverMesh();
+
+    // count the faces and face nodes to allocate everything once
+    std::size_t nFaces = 0, nFaceNodes = 0;
+    for(const Element& element : mesh.elements)
+    {
+        nFaces += element.edges.size();
+        for(const Edge& edge : element.edges)
+            nFaceNodes += edge.offsetInElm.size();
+    }
+
+    solverMesh.elmType.reserve(mesh.elements.size());
+    solverMesh.elmOffsetInU.reserve(mesh.elements.size());
+    solverMesh.elmFaceBegin.reserve(mesh.elements.size() + 1);
+    solverMesh.elmAffine.reserve(mesh.elements.size());
+    solverMesh.elmLength.reserve(mesh.elements.size());
+    solverMesh.faceNormal.reserve(mesh.dim*nFaces);
+    solverMesh.faceDetLD.reserve(nFaces);
+    solverMesh.faceNodeBegin.reserve(nFaces + 1);
+    solverMesh.nodeOffsetInElm.reserve(nFaceNodes);
+    solverMesh.nodePoint.reserve(nFaceNodes);
+    solverMesh.nodeSign.reserve(nFaceNodes);
+
+    for(std::size_t elm = 0 ; elm < mesh.elements.size() ; ++elm)
+    {
+        const Element& element = mesh.elements[elm];
+
+        // element types are numbered in order of appearance
+        auto typeId = std::find(solverMesh.types.begin(), solverMesh.types.end(),
+                                element.elementTypeHD);
+        if(typeId == solverMesh.types.end())
         {
-            // check if the edge is on the boundary of the domain
-            // if not, try to find the edge neighbour in a previously computed element
-            if(!IsBoundary(mesh.nodesTagBoundary, element.edges[i]))
-                findInFrontEdge(mesh, element.edges[i], i);
+            const ElementProperty& elmPropLD
+                = mesh.elementProperties.at(element.elementTypeLD);
+
+            solverMesh.types.push_back(element.elementTypeHD);
+            solverMesh.typeNSF.push_back(mesh.elementProperties
+                                         .at(element.elementTypeHD).nSF);
+            solverMesh.typeFaceNodes.push_back(elmPropLD.nSF);
+            solverMesh.typeLiftBegin.push_back(solverMesh.typeLift.size());
+            for(unsigned int a = 0 ; a < elmPropLD.nSF ; ++a)
+            {
+                solverMesh.typeLift.insert(solverMesh.typeLift.end(),
+                                           elmPropLD.lalb[a].begin(),
+                                           elmPropLD.lalb[a].end());
+            }
 
+            typeId = solverMesh.types.end() - 1;
         }
-        else
+
+        solverMesh.elmType.push_back(typeId - solverMesh.types.begin());
+        solverMesh.elmOffsetInU.push_back(element.offsetInU);
+        solverMesh.elmFaceBegin.push_back(solverMesh.faceDetLD.size());
+        solverMesh.elmAffine.push_back(isAffine(element));
+        solverMesh.elmLength.push_back(elementLength(element,
+                                       mesh.elementProperties
+                                       .at(element.elementTypeHD), mesh.dim));
+
+        for(const Edge& edge : element.edges)
         {
-            IsBoundary(mesh.nodesTagBoundary, element.edges[i]);
-        }
+            unsigned int face = solverMesh.faceDetLD.size();
 
-        // compute the normal of the edge and get the nodes coordinates of the edge
-        computeEdgeNormalCoord(element.edges[i], mesh.dim, elementBarycenter);
+            for(unsigned short dim = 0 ; dim < mesh.dim ; ++dim)
+                solverMesh.faceNormal.push_back(edge.normal[dim]);
 
-        // compute some essential matrix for the DG-FEM method
-        Eigen::SparseMatrix<double> dMs(mesh.elementProperties.at(eleTypeHD).nSF,
-                                        mesh.elementProperties.at(eleTypeHD).nSF);
-        std::vector<Eigen::Triplet<double>> indices;
+            solverMesh.faceDetLD.push_back(edge.determinantLD[0]);
+            solverMesh.faceNodeBegin.push_back(solverMesh.nodePoint.size());
 
-        for(size_t nA = 0 ; nA <  element.edges[i].nodeTags.size() ; ++nA)
-        {
-            for(size_t nB = 0 ; nB <  element.edges[i].nodeTags.size() ; ++nB)
+            bool boundary = (edge.edgeInFront.first == -1);
+
+            // an interior edge is owned by its element of lowest index, which
+            // creates its face points (with its own normal)
+            if(!boundary && edge.edgeInFront.first < elm)
+            {
+                unsigned int faceInFront
+                    = solverMesh.elmFaceBegin[edge.edgeInFront.first]
+                    + edge.edgeInFront.second;
+
+                for(unsigned int j = 0 ; j < edge.offsetInElm.size() ; ++j)
+                {
+                    unsigned int nodeInFront = solverMesh.faceNodeBegin[faceInFront]
+                                             + edge.nodeIndexEdgeInFront[j];
+
+                    solverMesh.nodeOffsetInElm.push_back(edge.offsetInElm[j]);
+                    solverMesh.nodePoint.push_back(solverMesh
+                                                    .nodePoint[nodeInFront]);
+                    solverMesh.nodeSign.push_back(-1);
+                }
+
+                continue;
+            }
+
+            int bc = -1;
+            if(boundary)
             {
-                indices.push_back(Eigen::Triplet<double>
-                    (element.edges[i].offsetInElm[nA],
-                        element.edges[i].offsetInElm[nB],
-                        mesh.elementProperties.at(eleTypeLD).lalb[nA][nB]));
+                // bcNames is sorted
+                bc = std::lower_bound(mesh.bcNames.begin(), mesh.bcNames.end(),
+                                      edge.bcName) - mesh.bcNames.begin();
+            }
+
+            for(unsigned int j = 0 ; j < edge.offsetInElm.size() ; ++j)
+            {
+                unsigned int indexJ = element.offsetInU + edge.offsetInElm[j];
+
+                solverMesh.nodeOffsetInElm.push_back(edge.offsetInElm[j]);
+                solverMesh.nodePoint.push_back(solverMesh.pointFace.size());
+                solverMesh.nodeSign.push_back(1);
+
+                solverMesh.pointFace.push_back(face);
+                solverMesh.pointIndex.push_back(indexJ);
+                solverMesh.pointBC.push_back(bc);
+
+                if(boundary)
+                    solverMesh.pointIndex.push_back(indexJ);
+                else
+                {
+                    const Element& elementInFront
+                        = mesh.elements[edge.edgeInFront.first];
+                    const Edge& edgeInFront
+                        = elementInFront.edges[edge.edgeInFront.second];
+
+                    solverMesh.pointIndex.push_back(elementInFront.offsetInU
+                        + edgeInFront.offsetInElm[edge.nodeIndexEdgeInFront[j]]);
+                }
+
+                solverMesh.pointCoord.insert(solverMesh.pointCoord.end(),
+                                             edge.nodeCoordinate[j].begin(),
+                                             edge.nodeCoordinate[j].begin() + 3);
             }
         }
-        dMs.setFromTriplets(indices.begin(), indices.end());
-        element.dM.push_back(dMs);
     }
 
-    // add the element to the mesh
-    mesh.elements.push_back(element);
+    solverMesh.elmFaceBegin.push_back(solverMesh.faceDetLD.size());
+    solverMesh.faceNodeBegin.push_back(solverMesh.nodePoint.size());
 }
 
 
@@ -455,10 +613,12 @@ static void addElement(Mesh& mesh, int elementTag, int eleTypeHD,
  * \param currentOffset Offset in u unknown vector.
  * \param intScheme Integration scheme for the basis functions evaluation.
  * \param basisFuncType The type of basis function you will use.
+ * \param nodesCoord Coordinates of the nodes of the mesh, indexed by node tag.
  * \return true if then entity was added flawlessly, false otherwise.
  */
 static bool buildMesh(Mesh& mesh, int entityTag, unsigned int& currentOffset,
-                      const std::string& intScheme, const std::string& basisFuncType)
+                      const std::string& intScheme, const std::string& basisFuncType,
+                      const std::vector<double>& nodesCoord)
 {
     // fill an entity structure
     mesh.entityTagHD = entityTag;
@@ -604,7 +764,7 @@ static bool buildMesh(Mesh& mesh, int entityTag, unsigned int& currentOffset,
                         nGPLD, currentOffset,
                         std::move(nodesTagPerEdgeElement),
                         std::move(nodeTagsElement),
-                        elementBarycenter);
+                        elementBarycenter, nodesCoord);
 
             currentOffset += elementOffset;
         }
@@ -617,6 +777,96 @@ static bool buildMesh(Mesh& mesh, int entityTag, unsigned int& currentOffset,
 }
 
 
+/**
+ * \brief Compute the key identifying an edge, independently of its orientation.
+ * \param edge The edge of which the key is computed.
+ * \return The sorted tags of the two vertices of the edge, packed in one integer.
+ */
+static std::uint64_t edgeKey(const Edge& edge)
+{
+    // normally first and second node tags are vertex (a single node in 1D)
+    std::uint32_t tag1 = static_cast<std::uint32_t>(edge.nodeTags[0]);
+    std::uint32_t tag2 = static_cast<std::uint32_t>(edge.nodeTags.size() > 1 ?
+                                                    edge.nodeTags[1] : tag1);
+    if(tag1 > tag2)
+        std::swap(tag1, tag2);
+
+    return (static_cast<std::uint64_t>(tag1) << 32) | tag2;
+}
+
+
+/**
+ * \brief Find the "edge in front" of every edge which is not on a boundary.
+ * \param mesh The mesh whose elements are linked together.
+ * \return true if every edge is either on a boundary or has a neighbour,
+ * false otherwise.
+ */
+static bool buildConnectivity(Mesh& mesh)
+{
+    // single pass over the edges: an edge which is not yet in the map waits for
+    // its neighbour, which will necessarily be found later if it is not a boundary
+    std::unordered_map<std::uint64_t, std::pair<unsigned int, unsigned int>>
+        openEdges;
+    std::vector<std::pair<std::pair<unsigned int, unsigned int>,
+                          std::pair<unsigned int, unsigned int>>> neighbours;
+
+    if(!mesh.elements.empty())
+        openEdges.reserve(mesh.elements.size()*mesh.elements[0].edges.size()/2 + 1);
+
+    for(unsigned int elm = 0 ; elm < mesh.elements.size() ; ++elm)
+    {
+        for(unsigned int s = 0 ; s < mesh.elements[elm].edges.size() ; ++s)
+        {
+            if(!mesh.elements[elm].edges[s].bcName.empty())
+                continue;
+
+            std::uint64_t key = edgeKey(mesh.elements[elm].edges[s]);
+            auto openEdge = openEdges.find(key);
+            if(openEdge == openEdges.end())
+            {
+                openEdges.emplace(key,
+                                  std::pair<unsigned int, unsigned int>(elm, s));
+            }
+            else
+            {
+                neighbours.push_back({openEdge->second,
+                                      std::pair<unsigned int, unsigned int>(elm, s)});
+                openEdges.erase(openEdge);
+            }
+        }
+    }
+
+    if(!openEdges.empty())
+    {
+        std::cerr << openEdges.size() << " edge(s) have neither a neighbour nor a"
+                  << " boundary condition" << std::endl;
+
+        return false;
+    }
+
+    // each pair of edges is independent from the others
+    #pragma omp parallel for default(none) shared(mesh, neighbours)
+    for(size_t i = 0 ; i < neighbours.size() ; ++i)
+    {
+        Edge& first = mesh.elements[neighbours[i].first.first]
+                        .edges[neighbours[i].first.second];
+        Edge& second = mesh.elements[neighbours[i].second.first]
+                        .edges[neighbours[i].second.second];
+
+        // the permutation tracks if the nodes are inverted in the edge in front
+        std::vector<unsigned int> permutation1, permutation2;
+        isPermutation(second.nodeTags, first.nodeTags, permutation1, permutation2);
+
+        second.edgeInFront = neighbours[i].first;
+        first.edgeInFront = neighbours[i].second;
+        second.nodeIndexEdgeInFront = std::move(permutation1);
+        first.nodeIndexEdgeInFront = std::move(permutation2);
+    }
+
+    return true;
+}
+
+
 /**
  * \brief Compute the mesh dimension.
  * \return The mesh dimension (1, 2 or 3).
@@ -669,8 +919,6 @@ std::vector<int> getTags(const Mesh& mesh)
 bool readMesh(Mesh& mesh, const std::string& fileName,
                 const std::string& intScheme, const std::string& basisFuncType)
 {
-    gmsh::initialize();
-    gmsh::option::setNumber("General.Terminal", 1);
     std::ifstream file(fileName);
     if(file.is_open())
         file.close();
@@ -679,6 +927,20 @@ bool readMesh(Mesh& mesh, const std::string& fileName,
         std::cerr << "File: " << fileName << " does not exist!" << std::endl;
         return false;
     }
+
+    // a previous run may already have built this mesh
+    if(loadMeshCache(mesh, fileName, intScheme, basisFuncType))
+    {
+        std::cout << "Mesh loaded from cache file " << getMeshCacheName(fileName)
+                  << std::endl;
+
+        buildSolverMesh(mesh);
+
+        return true;
+    }
+
+    gmsh::initialize();
+    gmsh::option::setNumber("General.Terminal", 1);
     gmsh::open(fileName);
 
     // check that the mesh is not 3D
@@ -698,7 +960,8 @@ bool readMesh(Mesh& mesh, const std::string& fileName,
     gmsh::model::getPhysicalGroups(BCHandles, mesh.dim - 1);
 
     // physical groups of dimension mesh.dim-1 are boundary conditions.
-    // we then retrieve and store the tag of each node in those boundaries.
+    // we then retrieve the tag of each node in those boundaries.
+    std::map<std::string, std::vector<std::size_t>> nodesTagBoundary;
     for(auto BCHandle : BCHandles)
     {
         std::string name;
@@ -707,7 +970,17 @@ bool readMesh(Mesh& mesh, const std::string& fileName,
         std::vector<double> dummyCoord;
         gmsh::model::mesh::getNodesForPhysicalGroup(mesh.dim - 1, BCHandle.second,
                                                     nodesTags, dummyCoord);
-        mesh.nodesTagBoundary[name] = nodesTags;
+        nodesTagBoundary[name] = std::move(nodesTags);
+    }
+
+    // and we index, for each of those nodes, the boundaries it belongs to
+    // (the boundaries are numbered in alphabetical order)
+    for(auto& nodeTagBoundary : nodesTagBoundary)
+    {
+        unsigned int bc = mesh.bcNames.size();
+        mesh.bcNames.push_back(nodeTagBoundary.first);
+        for(std::size_t nodeTag : nodeTagBoundary.second)
+            mesh.nodesBoundary[nodeTag].push_back(bc);
     }
 
     // we assume that a physical group contains only one entity and we retrieve them.
@@ -734,15 +1007,30 @@ bool readMesh(Mesh& mesh, const std::string& fileName,
         return false;
     }
 
+    // the coordinates of all the nodes are retrieved at once
+    std::vector<double> nodesCoord;
+    loadNodesCoord(nodesCoord);
+
     for(auto entityTag : entitiesTag)
     {
-        if(!buildMesh(mesh, entityTag, currentOffset, intScheme, basisFuncType))
+        if(!buildMesh(mesh, entityTag, currentOffset, intScheme, basisFuncType,
+                      nodesCoord))
             return false;
     }
 
+    // link the edges shared by two elements
+    if(!buildConnectivity(mesh))
+        return false;
+
     loadNodeData(mesh);
 
     gmsh::finalize();
 
+    if(!writeMeshCache(mesh, fileName, intScheme, basisFuncType))
+        std::cerr << "WARNING: unable to write the mesh cache file "
+                  << getMeshCacheName(fileName) << std::endl;
+
+    buildSolverMesh(mesh);
+
     return true;
 }
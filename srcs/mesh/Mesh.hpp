@@ -3,9 +3,9 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
-#include <Eigen/Sparse>
 
 /**
  * \struct Edge
@@ -63,8 +63,6 @@ struct Element
     std::vector<int> nodeTags;          /**< List of node tags of the element */
     std::vector<std::vector<double>> nodesCoord;    /**< Node coordinates
                                                         of the elemnts */
-
-    std::vector<Eigen::SparseMatrix<double>> dM;    /**< Partial M matrix */
 };
 
 
@@ -112,6 +110,71 @@ struct NodeData
 };
 
 
+/**
+ * \struct SolverMesh
+ * \brief Flat (structure of arrays) copy of the mesh data needed by the solver
+ * loops. The faces are the edges of each element, stored element after element
+ * (an interior edge thus appears twice, once for each of its elements), and the
+ * face nodes are stored face after face. The face points are the nodes of the
+ * edges counted once: the numerical fluxes are evaluated there.
+ */
+struct SolverMesh
+{
+    std::vector<int> types;                 /**< Element type (gmsh) of each dense
+                                                element type id */
+    std::vector<unsigned int> typeNSF;      /**< Number of shape functions of
+                                                each element type id */
+    std::vector<unsigned int> typeFaceNodes;/**< Number of nodes of the faces of
+                                                each element type id */
+    std::vector<unsigned int> typeLiftBegin;/**< Index of the lift operator of
+                                                each element type id in typeLift */
+    std::vector<double> typeLift;           /**< Reference face mass matrix
+                                                l_a*l_b of each element type id
+                                                (row major, common to its faces,
+                                                scaled by the face determinant) */
+
+    std::vector<unsigned int> elmType;      /**< Element type id of each element */
+    std::vector<unsigned int> elmOffsetInU; /**< Offset of each element in the
+                                                unknowns vector */
+    std::vector<unsigned int> elmFaceBegin; /**< Index of the first face of each
+                                                element (size: nElements + 1) */
+    std::vector<bool> elmAffine;            /**< true if the Jacobian of each
+                                                element is constant (straight-sided
+                                                element) */
+    std::vector<double> elmLength;          /**< Characteristic length of each
+                                                element for the CFL condition:
+                                                2*|K|/(|dK|*(2p + 1)), p being
+                                                the order of the element */
+
+    std::vector<double> faceNormal;         /**< Outward normal of each face
+                                                (dim components per face) */
+    std::vector<double> faceDetLD;          /**< Determinant of the variable change
+                                                of each (straight) face */
+    std::vector<unsigned int> faceNodeBegin;/**< Index of the first node of each
+                                                face (size: nFaces + 1) */
+
+    std::vector<unsigned int> nodeOffsetInElm;  /**< Index of each face node in
+                                                    its element */
+    std::vector<unsigned int> nodePoint;        /**< Face point of each face node */
+    std::vector<double> nodeSign;               /**< 1 if the normal of the face
+                                                    point is the outward normal
+                                                    of the face, -1 otherwise */
+
+    std::vector<unsigned int> pointFace;    /**< Face whose normal is the normal
+                                                of each face point */
+    std::vector<unsigned int> pointIndex;   /**< Index in the unknowns vector of
+                                                each face point on both sides
+                                                (2 per point: the side of
+                                                pointFace, then the one in front,
+                                                the same on a boundary) */
+    std::vector<int> pointBC;               /**< Index in bcNames of the BC of
+                                                each face point, -1 inside the
+                                                domain */
+    std::vector<double> pointCoord;         /**< Coordinates of each face point
+                                                (3 per point) */
+};
+
+
 /**
  * \struct Mesh
  * \brief Represents a mesh.
@@ -122,8 +185,12 @@ struct Mesh
                                                             properties for each
                                                             element type */
 
-    std::map<std::string, std::vector<std::size_t>> nodesTagBoundary;/**< Tags of the nodes
-                                                                    per BC */
+    std::vector<std::string> bcNames;   /**< Names of the physical groups of the
+                                            BC, sorted alphabetically */
+
+    std::unordered_map<std::size_t, std::vector<unsigned int>> nodesBoundary;
+                                        /**< Indices (in bcNames, sorted) of the
+                                            BC each boundary node belongs to */
 
     int entityTagHD;                    /**< Tag of the HD entity*/
     int entityTagLD;                    /**< Tag of the LD entity linked to this
@@ -134,6 +201,9 @@ struct Mesh
     unsigned short dim;             /**< Mesh dimension (1, 2, (3)) */
 
     NodeData nodeData;
+
+    SolverMesh solverMesh;          /**< Flat data for the solver (built from the
+                                         elements once they are complete) */
 };
 
 /**
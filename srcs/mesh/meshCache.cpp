@@ -0,0 +1,473 @@
+/**
+ * \file meshCache.cpp
+ * \brief Implementation of the binary cache of preprocessed meshes.
+ *
+ * The cache file starts with a header (format version, layout of the native
+ * types, hash and size of the .msh file, integration scheme and basis functions),
+ * followed by the mesh itself, where every vector of numbers is stored as its
+ * size followed by its raw content. The file is memory-mapped when reading it,
+ * such that loading it reduces to copying those raw arrays.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include <utility>
+#include "meshCache.hpp"
+#include "../utils/mappedFile.hpp"
+
+#if defined(_WIN32)
+    #include <process.h>
+    #define getpid _getpid
+#else
+    #include <unistd.h>
+#endif
+
+
+// increase it each time the content of the cache changes
+static const std::uint32_t cacheVersion = 2;
+static const char cacheMagic[8] = {'M', 'P', 'H', 'M', 'S', 'H', 'C', 'A'};
+
+// read back differently if the cache was written with another endianness
+static const std::uint32_t cacheByteOrder = 0x01020304;
+
+// sizes of the native types stored as is in the cache
+static const std::uint32_t cacheTypeSizes = sizeof(int) << 16
+                                            | sizeof(unsigned int) << 8
+                                            | sizeof(std::size_t);
+
+
+/**
+ * \struct CacheWriter
+ * \brief Write values in a binary cache file.
+ */
+struct CacheWriter
+{
+    std::ofstream& out; /**< Output stream */
+
+    template<typename T>
+    void operator()(const T& value)
+    {
+        static_assert(std::is_arithmetic<T>::value, "unexpected type in cache");
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T1, typename T2>
+    void operator()(const std::pair<T1, T2>& value)
+    {
+        (*this)(value.first);
+        (*this)(value.second);
+    }
+
+    void operator()(const std::string& value)
+    {
+        (*this)(static_cast<std::uint64_t>(value.size()));
+        out.write(value.data(), value.size());
+    }
+
+    template<typename T>
+    void operator()(const std::vector<T>& values)
+    {
+        (*this)(static_cast<std::uint64_t>(values.size()));
+        writeContent(values, std::is_arithmetic<T>());
+    }
+
+    private:
+        template<typename T>
+        void writeContent(const std::vector<T>& values, std::true_type)
+        {
+            out.write(reinterpret_cast<const char*>(values.data()),
+                      values.size()*sizeof(T));
+        }
+
+        template<typename T>
+        void writeContent(const std::vector<T>& values, std::false_type)
+        {
+            for(const T& value : values)
+                (*this)(value);
+        }
+};
+
+
+/**
+ * \struct CacheReader
+ * \brief Read values from a (memory-mapped) binary cache file. Once something
+ * could not be read, ok is false and nothing more is read.
+ */
+struct CacheReader
+{
+    const char* current;    /**< Current position in the file */
+    const char* end;        /**< End of the file */
+    bool ok;                /**< Whether everything was read so far */
+
+    /**
+     * \brief Constructor
+     * \param begin Position of the first value to read.
+     * \param end End of the file.
+     */
+    CacheReader(const char* begin, const char* end)
+    : current(begin), end(end), ok(true) {}
+
+    template<typename T>
+    void operator()(T& value)
+    {
+        static_assert(std::is_arithmetic<T>::value, "unexpected type in cache");
+        if(!ok || static_cast<std::size_t>(end - current) < sizeof(T))
+        {
+            ok = false;
+            return;
+        }
+        std::memcpy(&value, current, sizeof(T));
+        current += sizeof(T);
+    }
+
+    template<typename T1, typename T2>
+    void operator()(std::pair<T1, T2>& value)
+    {
+        (*this)(value.first);
+        (*this)(value.second);
+    }
+
+    void operator()(std::string& value)
+    {
+        std::uint64_t size = 0;
+        (*this)(size);
+        if(!ok || static_cast<std::uint64_t>(end - current) < size)
+        {
+            ok = false;
+            return;
+        }
+        value.assign(current, size);
+        current += size;
+    }
+
+    template<typename T>
+    void operator()(std::vector<T>& values)
+    {
+        std::uint64_t size = 0;
+        (*this)(size);
+        readContent(values, size, std::is_arithmetic<T>());
+    }
+
+    private:
+        template<typename T>
+        void readContent(std::vector<T>& values, std::uint64_t size, std::true_type)
+        {
+            if(!ok || static_cast<std::uint64_t>(end - current)/sizeof(T) < size)
+            {
+                ok = false;
+                return;
+            }
+            values.resize(size);
+            std::memcpy(values.data(), current, size*sizeof(T));
+            current += size*sizeof(T);
+        }
+
+        template<typename T>
+        void readContent(std::vector<T>& values, std::uint64_t size, std::false_type)
+        {
+            // every value takes at least one byte, which prevents huge
+            // allocations on corrupted files
+            if(!ok || static_cast<std::uint64_t>(end - current) < size)
+            {
+                ok = false;
+                return;
+            }
+            values.resize(size);
+            for(T& value : values)
+                (*this)(value);
+        }
+};
+
+
+/**
+ * \brief Read or write the header of the cache file.
+ * \param archive CacheReader or CacheWriter.
+ * \param version Version of the cache format.
+ * \param byteOrder Byte order marker.
+ * \param typeSizes Sizes of the native types.
+ * \param meshHash Hash of the .msh file.
+ * \param meshSize Size of the .msh file.
+ * \param intScheme Integration scheme for the basis functions evaluation.
+ * \param basisFuncType The type of basis function.
+ */
+template<typename Archive, typename U32, typename U64, typename String>
+static void serializeHeader(Archive& archive, U32& version, U32& byteOrder,
+                            U32& typeSizes, U64& meshHash, U64& meshSize,
+                            String& intScheme, String& basisFuncType)
+{
+    archive(version);
+    archive(byteOrder);
+    archive(typeSizes);
+    archive(meshHash);
+    archive(meshSize);
+    archive(intScheme);
+    archive(basisFuncType);
+}
+
+
+/**
+ * \brief Read or write an element property.
+ * \param archive CacheReader or CacheWriter.
+ * \param elementProperty The (possibly const) element property.
+ */
+template<typename Archive, typename ElementPropertyT>
+static void serializeElementProperty(Archive& archive,
+                                     ElementPropertyT& elementProperty)
+{
+    archive(elementProperty.name);
+    archive(elementProperty.dim);
+    archive(elementProperty.order);
+    archive(elementProperty.numNodes);
+    archive(elementProperty.paramCoord);
+    archive(elementProperty.basisFunc);
+    archive(elementProperty.basisFuncGrad);
+    archive(elementProperty.intPoints);
+    archive(elementProperty.intWeigths);
+    archive(elementProperty.numComp);
+    archive(elementProperty.nGP);
+    archive(elementProperty.nSF);
+    archive(elementProperty.prodFunc);
+    archive(elementProperty.pondFunc);
+    archive(elementProperty.IJ);
+    archive(elementProperty.lalb);
+}
+
+
+/**
+ * \brief Read or write an edge (connectivity and geometry).
+ * \param archive CacheReader or CacheWriter.
+ * \param edge The (possibly const) edge.
+ */
+template<typename Archive, typename EdgeT>
+static void serializeEdge(Archive& archive, EdgeT& edge)
+{
+    archive(edge.determinantLD);
+    archive(edge.nodeTags);
+    archive(edge.nodeCoordinate);
+    archive(edge.normal);
+    archive(edge.length);
+    archive(edge.edgeInFront);
+    archive(edge.nodeIndexEdgeInFront);
+    archive(edge.bcName);
+    archive(edge.offsetInElm);
+}
+
+
+/**
+ * \brief Read or write an element.
+ * \param archive CacheReader or CacheWriter.
+ * \param element The (possibly const) element.
+ */
+template<typename Archive, typename ElementT>
+static void serializeElement(Archive& archive, ElementT& element)
+{
+    archive(element.elementTag);
+    archive(element.elementTypeHD);
+    archive(element.elementTypeLD);
+    archive(element.offsetInU);
+    archive(element.determinantHD);
+    archive(element.jacobianHD);
+    archive(element.nodeTags);
+    archive(element.nodesCoord);
+}
+
+
+/**
+ * \brief Read or write the node data of the mesh.
+ * \param archive CacheReader or CacheWriter.
+ * \param nodeData The (possibly const) node data.
+ */
+template<typename Archive, typename NodeDataT>
+static void serializeNodeData(Archive& archive, NodeDataT& nodeData)
+{
+    archive(nodeData.numNodes);
+    archive(nodeData.elementTags);
+    archive(nodeData.elementNumNodes);
+    archive(nodeData.nodeTags);
+    archive(nodeData.coord);
+}
+
+
+// see .hpp file for description
+std::string getMeshCacheName(const std::string& fileName)
+{
+    return fileName + ".cache";
+}
+
+
+// see .hpp file for description
+bool loadMeshCache(Mesh& mesh, const std::string& fileName,
+                   const std::string& intScheme, const std::string& basisFuncType)
+{
+    MappedFile cacheFile(getMeshCacheName(fileName));
+    if(!cacheFile.isOpen || cacheFile.size < sizeof(cacheMagic)
+       || std::memcmp(cacheFile.data, cacheMagic, sizeof(cacheMagic)) != 0)
+        return false;
+
+    CacheReader reader(cacheFile.data + sizeof(cacheMagic),
+                       cacheFile.data + cacheFile.size);
+
+    // check that the cache corresponds to that mesh and those parameters
+    std::uint32_t version = 0, byteOrder = 0, typeSizes = 0;
+    std::uint64_t meshHash = 0, meshSize = 0;
+    std::string cacheIntScheme, cacheBasisFuncType;
+    serializeHeader(reader, version, byteOrder, typeSizes, meshHash, meshSize,
+                    cacheIntScheme, cacheBasisFuncType);
+
+    if(!reader.ok || version != cacheVersion || byteOrder != cacheByteOrder
+       || typeSizes != cacheTypeSizes || cacheIntScheme != intScheme
+       || cacheBasisFuncType != basisFuncType)
+        return false;
+
+    MappedFile meshFile(fileName);
+    if(!meshFile.isOpen || meshFile.size != meshSize
+       || hashFile(meshFile) != meshHash)
+        return false;
+
+    // read the mesh itself
+    Mesh cachedMesh;
+    reader(cachedMesh.dim);
+    reader(cachedMesh.entityTagHD);
+    reader(cachedMesh.entityTagLD);
+    reader(cachedMesh.bcNames);
+
+    std::uint64_t count = 0;
+    reader(count);
+    for(std::uint64_t i = 0 ; i < count && reader.ok ; ++i)
+    {
+        std::size_t nodeTag = 0;
+        reader(nodeTag);
+        reader(cachedMesh.nodesBoundary[nodeTag]);
+    }
+
+    reader(count);
+    for(std::uint64_t i = 0 ; i < count && reader.ok ; ++i)
+    {
+        int elementType = 0;
+        reader(elementType);
+        serializeElementProperty(reader, cachedMesh.elementProperties[elementType]);
+    }
+
+    reader(count);
+    if(reader.ok && count <= static_cast<std::uint64_t>(reader.end - reader.current))
+        cachedMesh.elements.resize(count);
+
+    for(Element& element : cachedMesh.elements)
+    {
+        serializeElement(reader, element);
+
+        reader(count);
+        if(!reader.ok || count > static_cast<std::uint64_t>(reader.end - reader.current))
+        {
+            reader.ok = false;
+            break;
+        }
+
+        element.edges.resize(count);
+        for(Edge& edge : element.edges)
+            serializeEdge(reader, edge);
+    }
+
+    serializeNodeData(reader, cachedMesh.nodeData);
+
+    // the file should end exactly after the end marker
+    char endMagic[sizeof(cacheMagic)];
+    for(char& c : endMagic)
+        reader(c);
+
+    if(!reader.ok || reader.current != reader.end
+       || std::memcmp(endMagic, cacheMagic, sizeof(cacheMagic)) != 0)
+        return false;
+
+    mesh = std::move(cachedMesh);
+
+    return true;
+}
+
+
+// see .hpp file for description
+bool writeMeshCache(const Mesh& mesh, const std::string& fileName,
+                    const std::string& intScheme, const std::string& basisFuncType)
+{
+    MappedFile meshFile(fileName);
+    if(!meshFile.isOpen)
+        return false;
+
+    std::uint32_t version = cacheVersion;
+    std::uint32_t byteOrder = cacheByteOrder;
+    std::uint32_t typeSizes = cacheTypeSizes;
+    std::uint64_t meshHash = hashFile(meshFile);
+    std::uint64_t meshSize = meshFile.size;
+
+    // the cache is written in a file of this process, then renamed, such that
+    // another run mapping the cache never sees a partially written file
+    std::string cacheName = getMeshCacheName(fileName);
+    std::string tempName = cacheName + "." + std::to_string(getpid());
+
+    std::ofstream out(tempName, std::ios::binary | std::ios::trunc);
+    if(!out.is_open())
+        return false;
+
+    CacheWriter writer{out};
+
+    out.write(cacheMagic, sizeof(cacheMagic));
+    serializeHeader(writer, version, byteOrder, typeSizes, meshHash, meshSize,
+                    intScheme, basisFuncType);
+
+    writer(mesh.dim);
+    writer(mesh.entityTagHD);
+    writer(mesh.entityTagLD);
+    writer(mesh.bcNames);
+
+    writer(static_cast<std::uint64_t>(mesh.nodesBoundary.size()));
+    for(const auto& nodeBoundary : mesh.nodesBoundary)
+    {
+        writer(nodeBoundary.first);
+        writer(nodeBoundary.second);
+    }
+
+    writer(static_cast<std::uint64_t>(mesh.elementProperties.size()));
+    for(const auto& elementProperty : mesh.elementProperties)
+    {
+        writer(elementProperty.first);
+        serializeElementProperty(writer, elementProperty.second);
+    }
+
+    writer(static_cast<std::uint64_t>(mesh.elements.size()));
+    for(const Element& element : mesh.elements)
+    {
+        serializeElement(writer, element);
+
+        writer(static_cast<std::uint64_t>(element.edges.size()));
+        for(const Edge& edge : element.edges)
+            serializeEdge(writer, edge);
+    }
+
+    serializeNodeData(writer, mesh.nodeData);
+
+    out.write(cacheMagic, sizeof(cacheMagic));
+    out.close();
+
+    if(!out)
+    {
+        std::remove(tempName.c_str());
+        return false;
+    }
+
+    // rename does not replace an existing file on Windows (where the cache is
+    // read in memory rather than mapped)
+    if(std::rename(tempName.c_str(), cacheName.c_str()) != 0)
+    {
+        std::remove(cacheName.c_str());
+        if(std::rename(tempName.c_str(), cacheName.c_str()) != 0)
+        {
+            std::remove(tempName.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
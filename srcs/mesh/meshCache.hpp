@@ -0,0 +1,44 @@
+#ifndef meshCache_hpp_included
+#define meshCache_hpp_included
+
+#include <string>
+#include "Mesh.hpp"
+
+
+/**
+ * \brief Get the name of the cache file associated with a mesh file.
+ * \param fileName The name of the .msh file.
+ * \return The name of the cache file, next to the .msh file.
+ */
+std::string getMeshCacheName(const std::string& fileName);
+
+
+/**
+ * \brief Load a preprocessed mesh from its binary cache file. The cache is only
+ * used if it was built by the same version of the format, from the same .msh file
+ * (same content) and with the same integration scheme and basis functions.
+ * \param mesh The structure which will contain loaded informations.
+ * \param fileName The name of the .msh file.
+ * \param intScheme Integration scheme for the basis functions evaluation.
+ * \param basisFuncType The type of basis function you will use.
+ * \return true if the mesh was loaded from the cache, false otherwise (mesh is
+ * then left untouched).
+ */
+bool loadMeshCache(Mesh& mesh, const std::string& fileName,
+                   const std::string& intScheme, const std::string& basisFuncType);
+
+
+/**
+ * \brief Write a preprocessed mesh in its binary cache file. The file is written
+ * under a temporary name and then renamed, so that concurrent runs loading the
+ * cache only see complete files.
+ * \param mesh The structure containing the mesh (as built by readMesh).
+ * \param fileName The name of the .msh file.
+ * \param intScheme Integration scheme for the basis functions evaluation.
+ * \param basisFuncType The type of basis function you will use.
+ * \return true if the cache file was written, false otherwise.
+ */
+bool writeMeshCache(const Mesh& mesh, const std::string& fileName,
+                    const std::string& intScheme, const std::string& basisFuncType);
+
+#endif // meshCache_hpp_included
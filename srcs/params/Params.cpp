@@ -12,7 +12,8 @@
 #include "Params.hpp"
 #include "../physics/boundaryConditions.hpp"
 #include "../physics/fluxes.hpp"
-#include "../physics/phiPsis.hpp"
+#include "../flux/faceFluxes.hpp"
+#include "../solver/timeStep.hpp"
 #include "../physics/sources.hpp"
 
 
@@ -208,7 +209,9 @@ static bool loadGeneralParams(const nlohmann::json& j,
     solverParams.basisFuncType = temp;
 
     temp = j["general"]["timeIntegrationType"];
-    if(!(temp == "RK1" || temp == "RK2" || temp == "RK3" || temp == "RK4"))
+    if(!(temp == "RK1" || temp == "RK2" || temp == "RK3" || temp == "RK4"
+         || temp == "LSRK54" || temp == "SSPRK3" || temp == "SSPRK54"
+         || temp == "SSPRK104" || temp == "ARS222" || temp == "ARS443"))
     {
         std::cerr << "Unexpected time integration type " << temp
                   << " in parameter file " << fileName << std::endl;
@@ -218,7 +221,7 @@ static bool loadGeneralParams(const nlohmann::json& j,
     solverParams.timeIntType = temp;
 
     temp = j["general"]["solverType"];
-    if(!(temp == "strong" || temp == "weak"))
+    if(!(temp == "strong" || temp == "weak" || temp == "fused"))
     {
         std::cerr << "Unexpected solver type " << temp
                   << " in parameter file " << fileName << std::endl;
@@ -227,12 +230,66 @@ static bool loadGeneralParams(const nlohmann::json& j,
     }
     solverParams.solverType = temp;
 
-    solverParams.simTime = j["general"]["simulationTime"];
+    temp = j["general"].value("outputMode", "gmsh");
+    if(!(temp == "gmsh" || temp == "stream" || temp == "binary"))
+    {
+        std::cerr << "Unexpected output mode " << temp
+                  << " in parameter file " << fileName << std::endl;
+
+        return false;
+    }
+    solverParams.outputMode = temp;
+    solverParams.outputBuffers = j["general"].value("outputBuffers", 0);
 
-    solverParams.timeStep = j["general"]["simulationTimeSteps"];
+    solverParams.simTime = j["general"]["simulationTime"];
 
     solverParams.simTimeDtWrite = j["general"]["simulationTimeToWrite"];
 
+    temp = j["general"].value("timeStepControl", "fixed");
+    if(temp == "fixed")
+    {
+        solverParams.timeStep = j["general"]["simulationTimeSteps"];
+    }
+    else if(temp == "CFL" || temp == "LTS")
+    {
+        // the time step is at most the time between two data writings
+        solverParams.timeStep = j["general"].value("simulationTimeSteps",
+                                                   solverParams.simTimeDtWrite);
+        solverParams.CFL = j["general"]["CFL"];
+        solverParams.timeStepUpdate = j["general"].value("timeStepUpdate", 1);
+        if(solverParams.CFL <= 0 || solverParams.timeStepUpdate == 0)
+        {
+            std::cerr << "Unexpected CFL number or time step update in parameter"
+                      << " file " << fileName << std::endl;
+
+            return false;
+        }
+
+        // the local time steps are forward Euler steps of the fused strong form
+        if(temp == "LTS")
+        {
+            solverParams.maxLevels = j["general"].value("maxLevels", 4);
+            if(solverParams.maxLevels == 0 || solverParams.timeIntType != "RK1"
+               || solverParams.solverType == "weak")
+            {
+                std::cerr << "The local time stepping requires at least one"
+                          << " level, the RK1 time integration and the strong or"
+                          << " fused solver type"
+                          << " in parameter file " << fileName << std::endl;
+
+                return false;
+            }
+        }
+    }
+    else
+    {
+        std::cerr << "Unexpected time step control " << temp
+                  << " in parameter file " << fileName << std::endl;
+
+        return false;
+    }
+    solverParams.timeStepControl = temp;
+
     return true;
 }
 
@@ -253,22 +310,30 @@ static bool loadPhysicsParams(const nlohmann::json& j,
     if(solverParams.problemType == "shallow")
     {
         solverParams.nUnknowns = 3;
+        solverParams.unknownNames = {"H", "Hu", "Hv"};
         solverParams.flux = fluxShallow;
+        solverParams.elementTimeSteps = computeElementTimeSteps<ShallowWater>;
     }
     else if(solverParams.problemType == "transport")
     {
         solverParams.nUnknowns = 1;
+        solverParams.unknownNames = {"C"};
         solverParams.flux = fluxTransport;
+        solverParams.elementTimeSteps = computeElementTimeSteps<Transport>;
     }
     else if(solverParams.problemType == "shallowLin")
     {
         solverParams.nUnknowns = 3;
+        solverParams.unknownNames = {"H", "Hu", "Hv"};
         solverParams.flux = fluxShallowLin;
+        solverParams.elementTimeSteps = computeElementTimeSteps<LinShallowWater>;
     }
     else if(solverParams.problemType == "AcousticLin")
     {
         solverParams.nUnknowns = 3;
+        solverParams.unknownNames = {"p'", "rho0u'", "rho0v'"};
         solverParams.flux = fluxAcousticLin;
+        solverParams.elementTimeSteps = computeElementTimeSteps<LinAcoustic>;
     }
     else
     {
@@ -284,7 +349,7 @@ static bool loadPhysicsParams(const nlohmann::json& j,
                solverParams.problemType == "shallowLin")
     {
         solverParams.whatToWrite.resize(5);
-        solverParams.viewTags.resize(5);
+        solverParams.viewTags.assign(5, -1);
         std::fill(solverParams.whatToWrite.begin(),
                   solverParams.whatToWrite.end(), false);
         for (unsigned short i = 0 ; i < whatToWrite.size() ; ++i)
@@ -311,7 +376,7 @@ static bool loadPhysicsParams(const nlohmann::json& j,
     else if(solverParams.problemType == "AcousticLin")
     {
         solverParams.whatToWrite.resize(5);
-        solverParams.viewTags.resize(5);
+        solverParams.viewTags.assign(5, -1);
         std::fill(solverParams.whatToWrite.begin(),
                   solverParams.whatToWrite.end(), false);
         for (unsigned short i = 0 ; i < whatToWrite.size() ; ++i)
@@ -338,7 +403,7 @@ static bool loadPhysicsParams(const nlohmann::json& j,
     else if(solverParams.problemType == "transport")
     {
         solverParams.whatToWrite.resize(1);
-        solverParams.viewTags.resize(1);
+        solverParams.viewTags.assign(1, -1);
         std::fill(solverParams.whatToWrite.begin(),
                   solverParams.whatToWrite.end(), false);
         for (unsigned short i = 0 ; i < whatToWrite.size() ; ++i)
@@ -377,17 +442,20 @@ static bool loadPhysicsParams(const nlohmann::json& j,
         if(temp == "LF")
         {
             solverParams.fluxType = temp;
-            solverParams.phiPsi = LFShallow;
+            solverParams.numericalFluxes = buildNumericalFluxes<ShallowWater, LF>;
+            solverParams.localFluxes = buildLocalFluxes<ShallowWater, LF>;
         }
         else if(temp == "Roe")
         {
             solverParams.fluxType = temp;
-            solverParams.phiPsi = Roe;
+            solverParams.numericalFluxes = buildNumericalFluxes<ShallowWater, Roe>;
+            solverParams.localFluxes = buildLocalFluxes<ShallowWater, Roe>;
         }
         else if(temp == "mean")
         {
             solverParams.fluxType = temp;
-            solverParams.phiPsi = mean;
+            solverParams.numericalFluxes = buildNumericalFluxes<ShallowWater, Mean>;
+            solverParams.localFluxes = buildLocalFluxes<ShallowWater, Mean>;
         }
         else
             error = true;
@@ -397,17 +465,20 @@ static bool loadPhysicsParams(const nlohmann::json& j,
         if(temp == "LF")
         {
             solverParams.fluxType = temp;
-            solverParams.phiPsi = LFShallowLin;
+            solverParams.numericalFluxes = buildNumericalFluxes<LinShallowWater, LF>;
+            solverParams.localFluxes = buildLocalFluxes<LinShallowWater, LF>;
         }
         else if(temp == "Roe")
         {
             solverParams.fluxType = temp;
-            solverParams.phiPsi = RoeLin;
+            solverParams.numericalFluxes = buildNumericalFluxes<LinShallowWater, Roe>;
+            solverParams.localFluxes = buildLocalFluxes<LinShallowWater, Roe>;
         }
         else if(temp == "mean")
         {
             solverParams.fluxType = temp;
-            solverParams.phiPsi = mean;
+            solverParams.numericalFluxes = buildNumericalFluxes<LinShallowWater, Mean>;
+            solverParams.localFluxes = buildLocalFluxes<LinShallowWater, Mean>;
         }
         else
             error = true;
@@ -417,7 +488,8 @@ static bool loadPhysicsParams(const nlohmann::json& j,
         if(temp == "LF")
         {
             solverParams.fluxType = temp;
-            solverParams.phiPsi = LFAcousticLin;
+            solverParams.numericalFluxes = buildNumericalFluxes<LinAcoustic, LF>;
+            solverParams.localFluxes = buildLocalFluxes<LinAcoustic, LF>;
         }
         else
             error = true;
@@ -427,12 +499,14 @@ static bool loadPhysicsParams(const nlohmann::json& j,
         if(temp == "LF")
         {
             solverParams.fluxType = temp;
-            solverParams.phiPsi = LFTransport;
+            solverParams.numericalFluxes = buildNumericalFluxes<Transport, LF>;
+            solverParams.localFluxes = buildLocalFluxes<Transport, LF>;
         }
         else if(temp == "mean")
         {
             solverParams.fluxType = temp;
-            solverParams.phiPsi = mean;
+            solverParams.numericalFluxes = buildNumericalFluxes<Transport, Mean>;
+            solverParams.localFluxes = buildLocalFluxes<Transport, Mean>;
         }
         else
             error = true;
@@ -495,17 +569,23 @@ static bool loadPhysicsParams(const nlohmann::json& j,
         {
             solverParams.sourceType = temp;
             solverParams.sourceTerm = sourceShallowCstGradCstFrict;
+            solverParams.localSourceTerm = localSourceShallowCstGradCstFrict;
+            solverParams.implicitSource = implicitSourceShallowCstGradCstFrict;
         }
         else if(temp == "sourceShallowCstGradQuadFrict"
                 && solverParams.problemType == "shallow")
         {
             solverParams.sourceType = temp;
             solverParams.sourceTerm = sourceShallowCstGradQuadFrict;
+            solverParams.localSourceTerm = localSourceShallowCstGradQuadFrict;
+            solverParams.implicitSource = implicitSourceShallowCstGradQuadFrict;
         }
         else if(temp == "shallowLinCst" && solverParams.problemType == "shallowLin")
         {
             solverParams.sourceType = temp;
             solverParams.sourceTerm = sourceShallowLinCst;
+            solverParams.localSourceTerm = localSourceShallowLinCst;
+            solverParams.implicitSource = implicitSourceShallowLinCst;
         }
         else
             error = true;
@@ -527,6 +607,17 @@ static bool loadPhysicsParams(const nlohmann::json& j,
             return false;
     }
 
+    // the IMEX schemes treat the source term implicitly
+    if((solverParams.timeIntType == "ARS222" || solverParams.timeIntType == "ARS443")
+       && (!solverParams.IsSourceTerms || !solverParams.implicitSource))
+    {
+        std::cerr << "The IMEX time integration " << solverParams.timeIntType
+                  << " requires a source term with an implicit solve"
+                  << std::endl;
+
+        return false;
+    }
+
 
     error = false;
     solverParams.sourceCoeffs = j["physics"]["sourceCoefficients"].get<std::vector<double>>();
@@ -607,11 +698,26 @@ bool loadSolverParams(const std::string& fileName, SolverParams& solverParams)
                 << std::endl
                 << "Formulation type: " << solverParams.solverType
                 << std::endl
+                << "Output mode: " << solverParams.outputMode
+                << (solverParams.outputBuffers > 0 ? " (output thread)" : "")
+                << std::endl
                 << "Simulation time duration: " << solverParams.simTime << "s"
                 << std::endl
                 << "Time step: " << solverParams.timeStep << "s"
-                << std::endl
-                << "Time between data writing: " << solverParams.simTimeDtWrite
+                << std::endl;
+    if(solverParams.timeStepControl != "fixed")
+    {
+        std::cout   << "Time step control: " << solverParams.timeStepControl
+                    << " " << solverParams.CFL
+                    << " (updated every " << solverParams.timeStepUpdate
+                    << " time steps)" << std::endl;
+    }
+    if(solverParams.timeStepControl == "LTS")
+    {
+        std::cout   << "Maximum number of time step levels: "
+                    << solverParams.maxLevels << std::endl;
+    }
+    std::cout   << "Time between data writing: " << solverParams.simTimeDtWrite
                 << "s"
                 << std::endl
                 << "Problem type: " << solverParams.problemType
@@ -18,23 +18,51 @@ struct SolverParams
     std::string spaceIntType;   /**< Number of points for Gauss integration
                                    (format Gaussx, x the number of points) */
     std::string basisFuncType;  /**< Type of basis functions (Lagrange or Isoparametric */
-    std::string timeIntType;    /**< Runge-Kutta time integration type (RK1 or RK4) */
-    std::string solverType;     /**< Solver form (strong or weak) */
+    std::string timeIntType;    /**< Runge-Kutta time integration type (RK1 to RK4,
+                                     LSRK54, SSPRK3, SSPRK54, SSPRK104, or the
+                                     IMEX schemes ARS222 and ARS443) */
+    std::string solverType;     /**< Solver form (strong, weak, or fused:
+                                     strong form in a single element pass) */
+    std::string outputMode;     /**< Output of the results (gmsh, the default:
+                                     the views are written at the end of the
+                                     simulation, stream: each step is
+                                     appended to the results file as soon as
+                                     it is computed, or binary: the unknowns
+                                     are appended in the binary snapshot
+                                     format, see snapshotFormat.hpp) */
+    unsigned int outputBuffers; /**< Number of snapshot buffers of the output
+                                     thread (0, the default: the results are
+                                     written by the solver thread) */
 
     double simTime;             /**< Simulation time duration */
     double timeStep;            /**< Time steps for the simulation */
     double simTimeDtWrite;      /**< Time between two data writings */
 
+    std::string timeStepControl; /**< Time step control (fixed, the default,
+                                      CFL: the time step is computed from the
+                                      wave speeds, timeStep being its upper
+                                      bound, or LTS: same as CFL with local
+                                      time steps) */
+    double CFL;                  /**< CFL number (CFL control only) */
+    unsigned int timeStepUpdate; /**< Number of time steps between two
+                                      computations of the time step (CFL
+                                      control only) */
+    unsigned short maxLevels;    /**< Maximum number of levels of the local
+                                      time steps (LTS control only) */
+
     std::map<std::string, ibc> boundaryConditions;  /**< Map of the problem's boundary condition*/
+    std::vector<ibc> meshBoundaryConditions;        /**< Boundary condition of each
+                                                         BC of the mesh (in the
+                                                         order of Mesh::bcNames)*/
     ibc initCondition;                              /**< Initial condition*/
 
     std::string problemType;     /**< Equations to solve (transport, shallow, ...)*/
+    std::vector<std::string> unknownNames; /**< Name of each unknown */
 
     std::function<void(Field& field,
-                       PartialField& partialField,
-                       const SolverParams& solverParams,
-                       bool boundary)> flux;    /**< Pointer to the flux function
-                                            (represents the physics of the problem)*/
+                       const SolverParams& solverParams)> flux;    /**< Pointer to the
+                                            flux function (represents the physics
+                                            of the problem)*/
 
     std::vector<double> fluxCoeffs; /**< Coefficient of the physical flux*/
 
@@ -44,27 +72,57 @@ struct SolverParams
     std::string fluxType;        /**< Type of numerical flux
                                       (mean, Lax-Friedirichs, Roe, ...)*/
 
-    std::function<void(const Edge& edge, Field& field, PartialField& partialField,
-                       unsigned int j, double factor, bool boundary,
-                       unsigned int indexJ, unsigned int indexFrontJ,
-                       const SolverParams& solverParams)> phiPsi; /**< Pointer to the
-                       rhs function (phi or psi depending of the type of scheme)*/
+    std::function<void(const Mesh& mesh, Field& field, double t,
+                       const SolverParams& solverParams)> numericalFluxes; /**<
+                       Pointer to the kernel computing the numerical flux at each
+                       face point (instantiated for the physics and the numerical
+                       flux, see buildNumericalFluxes)*/
+
+    std::function<void(const Mesh& mesh, const Field& field,
+                       const SolverParams& solverParams,
+                       std::vector<double>& elmTimeStep)> elementTimeSteps; /**<
+                       Pointer to the function computing the largest stable time
+                       step of each element (instantiated for the physics, see
+                       computeElementTimeSteps)*/
+
+    std::function<void(const Mesh& mesh, Field& field, double t,
+                       const SolverParams& solverParams,
+                       const std::vector<unsigned int>& elements,
+                       unsigned int nElements,
+                       const std::vector<unsigned int>& points,
+                       unsigned int nPoints)> localFluxes; /**< Pointer to the
+                       kernel computing the physical fluxes of some elements and
+                       the numerical fluxes at some face points (local time
+                       stepping, see buildLocalFluxes)*/
 
     bool IsSourceTerms;                 /**< (De)activate source terms computation*/
     std::string sourceType;             /**< Denotes the type of source terms*/
     std::vector<double> sourceCoeffs;   /**< Coefficient of the source terms*/
     std::function<void(Field& field, const SolverParams& solverParams)> sourceTerm;/**< Pointer to the source terms function*/
+    std::function<void(const Mesh& mesh, Field& field,
+                       const SolverParams& solverParams,
+                       const std::vector<unsigned int>& elements,
+                       unsigned int nElements)> localSourceTerm; /**< Pointer to
+                       the source terms function restricted to some elements
+                       (local time stepping)*/
+    std::function<void(Field& field, double a,
+                       const SolverParams& solverParams)> implicitSource; /**<
+                       Pointer to the function solving u - a*s(u) = u* at each
+                       node, u* being the explicit stage value given in field.u
+                       (implicit part of the IMEX schemes)*/
 
 
     std::vector<bool> whatToWrite; /**< Vector of boolean denoting
                                         what will be written (problem dependent)*/
-    std::vector<int> viewTags;  /**< Store the view tag of what will be written*/
+    std::vector<int> viewTags;  /**< Store the view tag of what will be written
+                                     (-1 if the view does not exist)*/
 
     std::function<void(std::vector<std::vector<double>>& uDisplay,
                   const std::vector<unsigned int>& elementNumNodes,
                   const std::vector<std::size_t>& elementTags,
                   const std::string& modelName,unsigned int nbreStep, double t,
-                  const Field& field, const std::vector<double>& fluxCoeffs,
+                  const std::vector<Eigen::VectorXd>& u,
+                  const std::vector<double>& fluxCoeffs,
                   const std::vector<bool>& whatToWrite,
                   std::vector<int>& viewTags)> write; /**< Pointer to the function
                                                            which will write*/
@@ -6,9 +6,9 @@
 
 
 // see .hpp file for description
-void constant(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void constant(std::vector<double>& uAtIBC, const double* pos,
               double t, const Field& field, unsigned int indexJ,
-              const std::vector<double>& edgeNormal,
+              const double* edgeNormal,
               const std::vector<double>& coeffs,
               const std::vector<double>& fluxCoeffs)
 {
@@ -12,9 +12,9 @@
 struct ibc
 {
     std::vector<double> coefficients; /**< Coefficient for the mathematical function */
-    std::function<void(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+    std::function<void(std::vector<double>& uAtIBC, const double* pos,
                         double t, const Field& field, unsigned int indexJ,
-                        const std::vector<double>& edgeNormal,
+                        const double* edgeNormal,
                         const std::vector<double>& coeffs,
                         const std::vector<double>& fluxCoeffs)> ibcFunc;
                         /**< Pointer to the mathematical function */
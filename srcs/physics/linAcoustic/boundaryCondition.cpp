@@ -5,9 +5,9 @@
 #include <iostream>
 
 // see .hpp file for description
-void sinusAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void sinusAcousticLin(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs)
 {
@@ -29,9 +29,9 @@ void sinusAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& po
 
 
 // see .hpp file for description
-void reflectAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void reflectAcousticLin(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs)
 {
@@ -47,9 +47,9 @@ void reflectAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>&
 }
 
 // see .hpp file for description
-void openAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void openAcousticLin(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs)
 {
@@ -70,15 +70,14 @@ void openAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& pos
 }
 
 // see .hpp file for description
-void gaussian2DAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian2DAcousticLin(std::vector<double>& uAtIBC, const double* pos,
                        double t, const Field& field, unsigned int indexJ,
-                       const std::vector<double>& edgeNormal,
+                       const double* edgeNormal,
                        const std::vector<double>& coeffs,
                        const std::vector<double>& fluxCoeffs)
 {
     // check that there is enough coefficients
     assert(coeffs.size() == 6);
-    assert(pos.size() == 3);
 
     // compute a 2D gaussian
     double X = (pos[0]-coeffs[1])*(pos[0]-coeffs[1])/(2*coeffs[2]);
@@ -90,15 +89,14 @@ void gaussian2DAcousticLin(std::vector<double>& uAtIBC, const std::vector<double
 }
 
 // see .hpp file for description
-void gaussian1DAcousticLinX(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian1DAcousticLinX(std::vector<double>& uAtIBC, const double* pos,
                         double t, const Field& field, unsigned int indexJ,
-                        const std::vector<double>& edgeNormal,
+                        const double* edgeNormal,
                         const std::vector<double>& coeffs,
                         const std::vector<double>& fluxCoeffs)
 {
     // check that there is enough coefficients
     assert(coeffs.size() == 4);
-    assert(pos.size() == 3);
 
     // compute a 1D gaussian along x
     double X = (pos[0]-coeffs[1])*(pos[0]-coeffs[1])/(2*coeffs[2]);
@@ -110,15 +108,14 @@ void gaussian1DAcousticLinX(std::vector<double>& uAtIBC, const std::vector<doubl
 
 
 // see .hpp file for description
-void gaussian1DAcousticLinY(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian1DAcousticLinY(std::vector<double>& uAtIBC, const double* pos,
                         double t, const Field& field, unsigned int indexJ,
-                        const std::vector<double>& edgeNormal,
+                        const double* edgeNormal,
                         const std::vector<double>& coeffs,
                         const std::vector<double>& fluxCoeffs)
 {
     // check that there is enough coefficients
     assert(coeffs.size() == 4);
-    assert(pos.size() == 3);
 
     // compute a 1D gaussian along y
     double Y = (pos[1]-coeffs[1])*(pos[1]-coeffs[1])/(2*coeffs[2]);
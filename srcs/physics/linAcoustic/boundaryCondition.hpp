@@ -10,7 +10,7 @@
  * \brief Compute a wave of the shape A*sin(2*pi*nu*t + phi) + B -- for the
  * linear acoustic.
  * \param uAtIBC Value of the BC unknowns at (x, y, z, t).
- * \param pos Node position.
+ * \param pos Node position (3 coordinates).
  * \param t Current time.
  * \param field Structure containing the current solution.
  * \param indexJ Index of the node corresponding to the boundary in the field structure.
@@ -18,40 +18,40 @@
  * coeffs[2] = phi, coeffs[3] = B.
  * \param fluxCoeffs Coefficients of the physical fluxes.
  */
-void sinusAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void sinusAcousticLin(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs);
 
 /**
  * \brief Compute a physical reflection -- for linear acoustic.
  * \param uAtIBC Value of the BC unknowns at (x, y, z, t).
- * \param pos Node position.
+ * \param pos Node position (3 coordinates).
  * \param t Current time.
  * \param field Structure containing the current solution.
  * \param indexJ Index of the node corresponding to the boundary in the field structure.
  * \param coeffs Coefficient (not used here).
  * \param fluxCoeffs Coefficients of the physical fluxes.
  */
-void reflectAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void reflectAcousticLin(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs);
 
 /**
  * \brief Compute a physical opening -- for linear acoustic.
  * \param uAtIBC Value of the BC unknowns at (x, y, z, t).
- * \param pos Node position.
+ * \param pos Node position (3 coordinates).
  * \param u The current solution.
  * \param t Current time.
  * \param coeffs Coefficient (not used here).
  * \param fluxCoeffs Coefficients of the physical fluxes.
  */
-void openAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void openAcousticLin(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs);
 
@@ -59,7 +59,7 @@ void openAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& pos
  * \brief Compute a 2D gaussian: A*exp(-(x-x0)^2/(2*var_y)-(y-y0)^2/(2*var_y)) -- for
  * linear acoustic.
  * \param uAtIBC Value of the BC unknowns at (x, y, z, t).
- * \param pos Node position.
+ * \param pos Node position (3 coordinates).
  * \param t Current time.
  * \param field Structure containing the current solution.
  * \param indexJ Index of the node corresponding to the boundary in the field structure.
@@ -67,9 +67,9 @@ void openAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& pos
  * coeffs[2] = var_x, coeffs[3] = y_0, coeffs[4] = var_y.
  * \param fluxCoeffs Coefficients of the physical fluxes.
  */
-void gaussian2DAcousticLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian2DAcousticLin(std::vector<double>& uAtIBC, const double* pos,
                         double t, const Field& field, unsigned int indexJ,
-                        const std::vector<double>& edgeNormal,
+                        const double* edgeNormal,
                         const std::vector<double>& coeffs,
                         const std::vector<double>& fluxCoeffs);
 
@@ -77,7 +77,7 @@ void gaussian2DAcousticLin(std::vector<double>& uAtIBC, const std::vector<double
  * \brief Compute a 1D gaussian along x: A*exp(-(x-x0)^2/(2*var_x) + B -- for linear
  * acoustic.
  * \param uAtIBC Value of the BC unknowns at (x, y, z, t).
- * \param pos Node position.
+ * \param pos Node position (3 coordinates).
  * \param t Current time.
  * \param field Structure containing the current solution.
  * \param indexJ Index of the node corresponding to the boundary in the field structure.
@@ -85,9 +85,9 @@ void gaussian2DAcousticLin(std::vector<double>& uAtIBC, const std::vector<double
  * coeffs[2] = var_x, coeffs[3] = B.
  * \param fluxCoeffs Coefficients of the physical fluxes.
  */
-void gaussian1DAcousticLinX(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian1DAcousticLinX(std::vector<double>& uAtIBC, const double* pos,
                         double t, const Field& field, unsigned int indexJ,
-                        const std::vector<double>& edgeNormal,
+                        const double* edgeNormal,
                         const std::vector<double>& coeffs,
                         const std::vector<double>& fluxCoeffs);
 
@@ -96,7 +96,7 @@ void gaussian1DAcousticLinX(std::vector<double>& uAtIBC, const std::vector<doubl
  * \brief Compute a 1D gaussian along y: A*exp(-(y-y0)^2/(2*var_y) + B -- for linear
  * acoustic.
  * \param uAtIBC Value of the BC unknowns at (x, y, z, t).
- * \param pos Node position.
+ * \param pos Node position (3 coordinates).
  * \param t Current time.
  * \param field Structure containing the current solution.
  * \param indexJ Index of the node corresponding to the boundary in the field structure.
@@ -104,9 +104,9 @@ void gaussian1DAcousticLinX(std::vector<double>& uAtIBC, const std::vector<doubl
  * coeffs[2] = var_y, coeffs[3] = B.
  * \param fluxCoeffs Coefficients of the physical fluxes.
  */
-void gaussian1DAcousticLinY(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian1DAcousticLinY(std::vector<double>& uAtIBC, const double* pos,
                         double t, const Field& field, unsigned int indexJ,
-                        const std::vector<double>& edgeNormal,
+                        const double* edgeNormal,
                         const std::vector<double>& coeffs,
                         const std::vector<double>& fluxCoeffs);
 
@@ -9,11 +9,8 @@
  * \brief Function that computes the physical flux for the linear acoustic
  * equations.
  * \param field Structure containing all the information about the computed unknowns.
- * \param partialField Structure containing temporary unknowns.
  * \param solverParams Structure containing the solver's parameters.
- * \param boundary Boolean that specifies if we consider a boundary (1) or not (0).
  */
-void fluxAcousticLin(Field& field, PartialField& partialField,
-                      const SolverParams& solverParams, bool boundary);
+void fluxAcousticLin(Field& field, const SolverParams& solverParams);
 
 #endif // linAcoustic_flux_hpp_included
@@ -0,0 +1,58 @@
+#ifndef linAcoustic_traits_hpp_included
+#define linAcoustic_traits_hpp_included
+
+#include <vector>
+
+
+/**
+ * \struct LinAcoustic
+ * \brief Pointwise physics of the linear acoustic equations, the unknowns being
+ * [p', u', v']. The numerical flux kernels are instantiated with it.
+ */
+struct LinAcoustic
+{
+    static constexpr unsigned short nUnknowns = 3; /**< Number of unknowns */
+
+    /**
+     * \brief Compute the physical flux at one node.
+     * \param u Unknowns at the node.
+     * \param F Physical flux at the node (F[dim][unk]).
+     * \param fluxCoeffs Coefficients of the physical flux (rho, c0, u0, v0).
+     */
+    static void flux(const double* u, double F[2][nUnknowns],
+                     const std::vector<double>& fluxCoeffs)
+    {
+        // the physical flux is given by
+        //  Fx = [rho*co^2*u' + u0*p',     p'/rho + u'*u0,            u'*v0]
+        //  Fy = [rho*co^2*v' + v0*p',              v'*u0,   p'/rho + v'*v0]
+        F[0][0] = fluxCoeffs[0]*fluxCoeffs[1]*fluxCoeffs[1]*u[1]
+                + fluxCoeffs[2]*u[0];
+        F[1][0] = fluxCoeffs[0]*fluxCoeffs[1]*fluxCoeffs[1]*u[2]
+                + fluxCoeffs[3]*u[0];
+
+        F[0][1] = u[0]/fluxCoeffs[0] + fluxCoeffs[2]*u[1];
+        F[0][2] = fluxCoeffs[3]*u[1];
+
+        F[1][1] = fluxCoeffs[2]*u[2];
+        F[1][2] = u[0]/fluxCoeffs[0] + fluxCoeffs[3]*u[2];
+    }
+
+    /**
+     * \brief Compute the absolute value of the largest eigenvalue of the flux
+     * Jacobian along a normal (for the LF flux).
+     * \param u Unknowns at the node.
+     * \param normal Normal along which the eigenvalue is computed.
+     * \param fluxCoeffs Coefficients of the physical flux (speed of sound).
+     * \return |u'.n| + c0.
+     */
+    static double maxEigenvalue(const double* u, const double* normal,
+                                const std::vector<double>& fluxCoeffs)
+    {
+        double c0 = fluxCoeffs[1];
+        double lambda = u[1]*normal[0] + u[2]*normal[1];
+
+        return (lambda >= 0) ? lambda + c0 : -lambda + c0;
+    }
+};
+
+#endif // linAcoustic_traits_hpp_included
@@ -5,9 +5,9 @@
 #include <iostream>
 
 // see .hpp file for description
-void sinusShallowLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void sinusShallowLin(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs)
 {
@@ -30,9 +30,9 @@ void sinusShallowLin(std::vector<double>& uAtIBC, const std::vector<double>& pos
 
 
 // see .hpp file for description
-void reflectShallowLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void reflectShallowLin(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs)
 {
@@ -49,9 +49,9 @@ void reflectShallowLin(std::vector<double>& uAtIBC, const std::vector<double>& p
 }
 
 // see .hpp file for description
-void openShallowLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void openShallowLin(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs)
 {
@@ -72,15 +72,14 @@ void openShallowLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
 }
 
 // see .hpp file for description
-void gaussian2DShallowLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian2DShallowLin(std::vector<double>& uAtIBC, const double* pos,
                        double t, const Field& field, unsigned int indexJ,
-                       const std::vector<double>& edgeNormal,
+                       const double* edgeNormal,
                        const std::vector<double>& coeffs,
                        const std::vector<double>& fluxCoeffs)
 {
     // check that there is enough coefficients
     assert(coeffs.size() == 6);
-    assert(pos.size() == 3);
 
     // compute a 2D gaussian
     double X = (pos[0]-coeffs[1])*(pos[0]-coeffs[1])/(2*coeffs[2]);
@@ -92,15 +91,14 @@ void gaussian2DShallowLin(std::vector<double>& uAtIBC, const std::vector<double>
 }
 
 // see .hpp file for description
-void gaussian1DShallowXLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian1DShallowXLin(std::vector<double>& uAtIBC, const double* pos,
                         double t, const Field& field, unsigned int indexJ,
-                        const std::vector<double>& edgeNormal,
+                        const double* edgeNormal,
                         const std::vector<double>& coeffs,
                         const std::vector<double>& fluxCoeffs)
 {
     // check that there is enough coefficients
     assert(coeffs.size() == 4);
-    assert(pos.size() == 3);
 
     // compute a 1D gaussian along x
     double X = (pos[0]-coeffs[1])*(pos[0]-coeffs[1])/(2*coeffs[2]);
@@ -112,15 +110,14 @@ void gaussian1DShallowXLin(std::vector<double>& uAtIBC, const std::vector<double
 
 
 // see .hpp file for description
-void gaussian1DShallowYLin(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian1DShallowYLin(std::vector<double>& uAtIBC, const double* pos,
                         double t, const Field& field, unsigned int indexJ,
-                        const std::vector<double>& edgeNormal,
+                        const double* edgeNormal,
                         const std::vector<double>& coeffs,
                         const std::vector<double>& fluxCoeffs)
 {
     // check that there is enough coefficients
     assert(coeffs.size() == 4);
-    assert(pos.size() == 3);
 
     // compute a 1D gaussian along y
     double Y = (pos[1]-coeffs[1])*(pos[1]-coeffs[1])/(2*coeffs[2]);
@@ -1,13 +1,66 @@
 #include "source.hpp"
 
 
+/**
+ * \brief Compute the source term of sourceShallowLinCst at some nodes.
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param solverParams Structure containing the solver's parameters.
+ * \param begin First node.
+ * \param nNodes Number of nodes.
+ */
+static void sourceLinCst(Field& field, const SolverParams& solverParams,
+                         unsigned int begin, unsigned int nNodes)
+{
+    field.s[0].segment(begin, nNodes).setZero();
+
+    field.s[1].segment(begin, nNodes)
+        = solverParams.sourceCoeffs[0]*solverParams.fluxCoeffs[1]
+          *field.u[2].segment(begin, nNodes);
+
+    field.s[2].segment(begin, nNodes)
+        = -solverParams.sourceCoeffs[0]*solverParams.fluxCoeffs[1]
+          *field.u[1].segment(begin, nNodes);
+}
+
+
 // see .hpp file for description
 void sourceShallowLinCst(Field& field, const SolverParams& solverParams)
 {
-    field.s[0].setZero();
+    sourceLinCst(field, solverParams, 0, field.u[0].size());
+}
 
-    field.s[1] = solverParams.sourceCoeffs[0]*solverParams.fluxCoeffs[1]*field.u[2];
 
-    field.s[2] = -solverParams.sourceCoeffs[0]*solverParams.fluxCoeffs[1]*field.u[1];
+// see .hpp file for description
+void localSourceShallowLinCst(const Mesh& mesh, Field& field,
+                              const SolverParams& solverParams,
+                              const std::vector<unsigned int>& elements,
+                              unsigned int nElements)
+{
+    const SolverMesh& solverMesh = mesh.solverMesh;
+
+    #if defined(_OPENMP)
+        #pragma omp parallel for default(none) \
+            shared(field, solverMesh, solverParams, elements, nElements)
+    #endif
+    for(unsigned int e = 0 ; e < nElements ; ++e)
+    {
+        unsigned int elm = elements[e];
+        sourceLinCst(field, solverParams, solverMesh.elmOffsetInU[elm],
+                     solverMesh.typeNSF[solverMesh.elmType[elm]]);
+    }
 }
 
+
+
+// see .hpp file for description
+void implicitSourceShallowLinCst(Field& field, double a,
+                                 const SolverParams& solverParams)
+{
+    double af = a*solverParams.sourceCoeffs[0]*solverParams.fluxCoeffs[1];
+
+    // u' - af*v' = rhsU and af*u' + v' = rhsV
+    Eigen::VectorXd rhsU = field.u[1];
+
+    field.u[1] = (rhsU + af*field.u[2])/(1 + af*af);
+    field.u[2] = (field.u[2] - af*rhsU)/(1 + af*af);
+}
@@ -14,4 +14,34 @@
  */
 void sourceShallowLinCst(Field& field, const SolverParams& solverParams);
 
+
+/**
+ * \brief Function that computes the source term of sourceShallowLinCst at the
+ * nodes of some elements only (local time stepping, see localTimeStepping.hpp).
+ * \param mesh The mesh of the problem.
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param solverParams Structure containing the solver's parameters.
+ * \param elements List of elements whose source term is computed.
+ * \param nElements Number of elements taken at the beginning of the list.
+ */
+void localSourceShallowLinCst(const Mesh& mesh, Field& field,
+                              const SolverParams& solverParams,
+                              const std::vector<unsigned int>& elements,
+                              unsigned int nElements);
+
+
+/**
+ * \brief Function that solves the implicit stage of the source term of
+ * sourceShallowLinCst, u - a*s(u) = u*, at each node, u* being the explicit stage
+ * value (exact solve of the rotation).
+ * \param field Structure containing all the information about the computed
+ * unknowns (field.u is the explicit stage value u* on input, then the
+ * solution u).
+ * \param a Coefficient of the source term (time step times the diagonal
+ * coefficient of the IMEX scheme).
+ * \param solverParams Structure containing the solver's parameters.
+ */
+void implicitSourceShallowLinCst(Field& field, double a,
+                                 const SolverParams& solverParams);
+
 #endif // linShallow_source_hpp_included
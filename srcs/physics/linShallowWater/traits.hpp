@@ -0,0 +1,72 @@
+#ifndef linShallow_traits_hpp_included
+#define linShallow_traits_hpp_included
+
+#include <vector>
+#include "../shallowWater/traits.hpp"
+
+
+/**
+ * \struct LinShallowWater
+ * \brief Pointwise physics of the linear shallow water equations, the unknowns
+ * being [H, u, v]. The numerical flux kernels are instantiated with it.
+ */
+struct LinShallowWater
+{
+    static constexpr unsigned short nUnknowns = 3; /**< Number of unknowns */
+
+    /**
+     * \brief Compute the physical flux at one node.
+     * \param u Unknowns at the node.
+     * \param F Physical flux at the node (F[dim][unk]).
+     * \param fluxCoeffs Coefficients of the physical flux (gravity, h0).
+     */
+    static void flux(const double* u, double F[2][nUnknowns],
+                     const std::vector<double>& fluxCoeffs)
+    {
+        // the physical flux is given by
+        //  Fx = [h0*u,     g*h0*H, 0       ]
+        //  Fy = [h0*v,     0,      g*h_0*h ]
+        F[0][0] = u[1];
+        F[1][0] = u[2];
+
+        F[0][1] = fluxCoeffs[0]*u[0]*fluxCoeffs[1];
+        F[0][2] = 0.0;
+
+        F[1][1] = 0.0;
+        F[1][2] = fluxCoeffs[0]*u[0]*fluxCoeffs[1];
+    }
+
+    /**
+     * \brief Compute the absolute value of the largest eigenvalue of the flux
+     * Jacobian along a normal (for the LF flux), as for the non-linear equations.
+     * \param u Unknowns at the node.
+     * \param normal Normal along which the eigenvalue is computed.
+     * \param fluxCoeffs Coefficients of the physical flux.
+     * \return The eigenvalue.
+     */
+    static double maxEigenvalue(const double* u, const double* normal,
+                                const std::vector<double>& fluxCoeffs)
+    {
+        return ShallowWater::maxEigenvalue(u, normal, fluxCoeffs);
+    }
+
+    /**
+     * \brief Compute the Roe averaged celerity and the (limited) Froude number
+     * along a normal, between two states, as for the non-linear equations.
+     * \param uIn Unknowns inside the element.
+     * \param uOut Unknowns outside the element.
+     * \param normal Normal of the edge.
+     * \param fluxCoeffs Coefficients of the physical flux.
+     * \param cRoe Roe averaged celerity.
+     * \param Fr Froude number, limited to [-1, 1].
+     */
+    static void roeAverages(const double* uIn, const double* uOut,
+                            const double* normal,
+                            const std::vector<double>& fluxCoeffs,
+                            double& cRoe, double& Fr)
+    {
+        ShallowWater::roeAverages(uIn, uOut, normal, fluxCoeffs, cRoe, Fr);
+    }
+};
+
+#endif // linShallow_traits_hpp_included
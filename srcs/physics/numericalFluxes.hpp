@@ -0,0 +1,118 @@
+#ifndef numericalFluxes_hpp_included
+#define numericalFluxes_hpp_included
+
+#include <vector>
+#include "shallowWater/traits.hpp"
+#include "linShallowWater/traits.hpp"
+#include "linAcoustic/traits.hpp"
+#include "transport/traits.hpp"
+
+// The numerical fluxes are templated on the physics (see the traits), such that
+// the number of unknowns is known at compile time and the physics is inlined.
+// They compute the flux normal to an edge at one of its nodes, from the unknowns
+// and the physical fluxes on both sides (In: inside the element whose normal is
+// used, Out: outside).
+
+
+/**
+ * \struct Mean
+ * \brief Numerical mean flux.
+ */
+template<class Physics>
+struct Mean
+{
+    static constexpr unsigned short N = Physics::nUnknowns;
+
+    /**
+     * \brief Compute the numerical flux.
+     * \param normal Outward normal of the edge.
+     * \param uIn Unknowns inside the element.
+     * \param uOut Unknowns outside the element.
+     * \param FIn Physical flux inside the element.
+     * \param FOut Physical flux outside the element.
+     * \param numFlux Numerical flux normal to the edge (one value per unknown).
+     * \param fluxCoeffs Coefficients of the physical flux.
+     */
+    static void compute(const double* normal, const double* uIn, const double* uOut,
+                        const double FIn[2][N], const double FOut[2][N],
+                        double* numFlux, const std::vector<double>& fluxCoeffs)
+    {
+        for(unsigned short unk = 0 ; unk < N ; ++unk)
+        {
+            numFlux[unk] = 0;
+            for(unsigned short dim = 0 ; dim < 2 ; ++dim)
+                numFlux[unk] += normal[dim]*(FIn[dim][unk] + FOut[dim][unk]);
+
+            numFlux[unk] /= 2;
+        }
+    }
+};
+
+
+/**
+ * \struct LF
+ * \brief Numerical Lax-Friedrichs flux, with the largest eigenvalue of both sides.
+ */
+template<class Physics>
+struct LF
+{
+    static constexpr unsigned short N = Physics::nUnknowns;
+
+    /**
+     * \brief Compute the numerical flux (see Mean::compute).
+     */
+    static void compute(const double* normal, const double* uIn, const double* uOut,
+                        const double FIn[2][N], const double FOut[2][N],
+                        double* numFlux, const std::vector<double>& fluxCoeffs)
+    {
+        double lambdaIn = Physics::maxEigenvalue(uIn, normal, fluxCoeffs);
+        double lambdaOut = Physics::maxEigenvalue(uOut, normal, fluxCoeffs);
+
+        // computation of the value of C in the LF scheme
+        double C = (lambdaIn > lambdaOut ? lambdaIn : lambdaOut);
+
+        for(unsigned short unk = 0 ; unk < N ; ++unk)
+        {
+            numFlux[unk] = C*(uIn[unk] - uOut[unk]);
+            for(unsigned short dim = 0 ; dim < 2 ; ++dim)
+                numFlux[unk] += normal[dim]*(FIn[dim][unk] + FOut[dim][unk]);
+
+            numFlux[unk] /= 2;
+        }
+    }
+};
+
+
+/**
+ * \struct Roe
+ * \brief Numerical Roe flux (for the shallow water equations).
+ */
+template<class Physics>
+struct Roe
+{
+    static constexpr unsigned short N = Physics::nUnknowns;
+
+    /**
+     * \brief Compute the numerical flux (see Mean::compute).
+     */
+    static void compute(const double* normal, const double* uIn, const double* uOut,
+                        const double FIn[2][N], const double FOut[2][N],
+                        double* numFlux, const std::vector<double>& fluxCoeffs)
+    {
+        double cRoe, Fr;
+        Physics::roeAverages(uIn, uOut, normal, fluxCoeffs, cRoe, Fr);
+
+        for(unsigned short unk = 0 ; unk < N ; ++unk)
+        {
+            numFlux[unk] = cRoe*(1 - Fr*Fr)*(uIn[unk] - uOut[unk]);
+            for(unsigned short dim = 0 ; dim < 2 ; ++dim)
+            {
+                numFlux[unk] += normal[dim]*((1 + Fr)*FIn[dim][unk]
+                                + (1 - Fr)*FOut[dim][unk]);
+            }
+            numFlux[unk] /= 2;
+        }
+    }
+};
+
+#endif // numericalFluxes_hpp_included
@@ -1,10 +0,0 @@
-#ifndef phiPsis_hpp_included
-#define phiPsis_hpp_included
-
-#include "meanPhiPsi.hpp"
-#include "linShallowWater/phiPsi.hpp"
-#include "shallowWater/phiPsi.hpp"
-#include "transport/phiPsi.hpp"
-#include "linAcoustic/phiPsi.hpp"
-
-#endif // phiPsis_hpp_included
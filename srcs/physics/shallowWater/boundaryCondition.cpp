@@ -5,9 +5,9 @@
 #include <iostream>
 
 // see .hpp file for description
-void reflectShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void reflectShallow(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs)
 {
@@ -25,9 +25,9 @@ void reflectShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
 
 
 // see .hpp file for description
-void openShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void openShallow(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs)
 {
@@ -49,9 +49,9 @@ void openShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
 }
 
 // see .hpp file for description
-void openAffShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void openAffShallow(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs)
 {
@@ -74,9 +74,9 @@ void openAffShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
 }
 
 // see .hpp file for description
-void affineShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void affineShallow(std::vector<double>& uAtIBC, const double* pos,
               double t, const Field& field, unsigned int indexJ,
-              const std::vector<double>& edgeNormal,
+              const double* edgeNormal,
               const std::vector<double>& coeffs,
               const std::vector<double>& fluxCoeffs)
 {
@@ -86,9 +86,9 @@ void affineShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
 }
 
 // see .hpp file for description
-void sinusShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void sinusShallow(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs)
 {
@@ -112,9 +112,9 @@ void sinusShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
 }
 
 // see .hpp file for description
-void sinusAffShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void sinusAffShallow(std::vector<double>& uAtIBC, const double* pos,
                     double t, const Field& field, unsigned int indexJ,
-                    const std::vector<double>& edgeNormal,
+                    const double* edgeNormal,
                     const std::vector<double>& coeffs,
                     const std::vector<double>& fluxCoeffs)
 {
@@ -139,15 +139,14 @@ void sinusAffShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos
 }
 
 // see .hpp file for description
-void gaussian2DShallow(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian2DShallow(std::vector<double>& uAtIBC, const double* pos,
                        double t, const Field& field, unsigned int indexJ,
-                       const std::vector<double>& edgeNormal,
+                       const double* edgeNormal,
                        const std::vector<double>& coeffs,
                        const std::vector<double>& fluxCoeffs)
 {
     // check that there is enough coefficients
     assert(coeffs.size() == 6);
-    assert(pos.size() == 3);
 
     // compute a 2D gaussian
     double X = (pos[0]-coeffs[1])*(pos[0]-coeffs[1])/(2*coeffs[2]);
@@ -160,15 +159,14 @@ void gaussian2DShallow(std::vector<double>& uAtIBC, const std::vector<double>& p
 
 
 // see .hpp file for description
-void gaussian1DShallowX(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian1DShallowX(std::vector<double>& uAtIBC, const double* pos,
                         double t, const Field& field, unsigned int indexJ,
-                        const std::vector<double>& edgeNormal,
+                        const double* edgeNormal,
                         const std::vector<double>& coeffs,
                         const std::vector<double>& fluxCoeffs)
 {
     // check that there is enough coefficients
     assert(coeffs.size() == 4);
-    assert(pos.size() == 3);
 
     // compute a 1D gaussian along x
     double X = (pos[0]-coeffs[1])*(pos[0]-coeffs[1])/(2*coeffs[2]);
@@ -180,15 +178,14 @@ void gaussian1DShallowX(std::vector<double>& uAtIBC, const std::vector<double>&
 
 
 // see .hpp file for description
-void gaussian1DShallowY(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian1DShallowY(std::vector<double>& uAtIBC, const double* pos,
                         double t, const Field& field, unsigned int indexJ,
-                        const std::vector<double>& edgeNormal,
+                        const double* edgeNormal,
                         const std::vector<double>& coeffs,
                         const std::vector<double>& fluxCoeffs)
 {
     // check that there is enough coefficients
     assert(coeffs.size() == 4);
-    assert(pos.size() == 3);
 
     // compute a 1D gaussian along y
     double Y = (pos[1]-coeffs[1])*(pos[1]-coeffs[1])/(2*coeffs[2]);
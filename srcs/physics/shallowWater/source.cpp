@@ -1,39 +1,189 @@
+#include <cmath>
 #include "source.hpp"
 
 
+/**
+ * \brief Compute the source term of sourceShallowCstGradCstFrict at some nodes.
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param solverParams Structure containing the solver's parameters.
+ * \param begin First node.
+ * \param nNodes Number of nodes.
+ */
+static void sourceCstGradCstFrict(Field& field, const SolverParams& solverParams,
+                                  unsigned int begin, unsigned int nNodes)
+{
+    field.s[0].segment(begin, nNodes).setZero();
+
+    field.s[1].segment(begin, nNodes)
+        = solverParams.sourceCoeffs[1]*field.u[2].segment(begin, nNodes)
+        + solverParams.fluxCoeffs[0]*solverParams.sourceCoeffs[2]
+          *field.u[0].segment(begin, nNodes)
+        - solverParams.sourceCoeffs[4]*field.u[1].segment(begin, nNodes)
+          /solverParams.sourceCoeffs[0];
+
+    field.s[2].segment(begin, nNodes)
+        = -solverParams.sourceCoeffs[1]*field.u[1].segment(begin, nNodes)
+        + solverParams.fluxCoeffs[0]*solverParams.sourceCoeffs[3]
+          *field.u[0].segment(begin, nNodes)
+        - solverParams.sourceCoeffs[4]*field.u[2].segment(begin, nNodes)
+          /solverParams.sourceCoeffs[0];
+}
+
+
+/**
+ * \brief Compute the source term of sourceShallowCstGradQuadFrict at some nodes.
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param solverParams Structure containing the solver's parameters.
+ * \param begin First node.
+ * \param nNodes Number of nodes.
+ */
+static void sourceCstGradQuadFrict(Field& field, const SolverParams& solverParams,
+                                   unsigned int begin, unsigned int nNodes)
+{
+    for(unsigned int n = begin ; n < begin + nNodes ; ++n)
+    {
+        double H = field.u[0][n];
+        double speedNorm = std::sqrt(field.u[1][n]*field.u[1][n]
+                                     + field.u[2][n]*field.u[2][n])/H;
+
+        field.s[0][n] = 0;
+
+        field.s[1][n] = solverParams.sourceCoeffs[1]*field.u[2][n]
+            + solverParams.fluxCoeffs[0]*solverParams.sourceCoeffs[2]*H
+            - solverParams.sourceCoeffs[4]*speedNorm*field.u[1][n]
+            /(solverParams.sourceCoeffs[0]*H);
+
+        field.s[2][n] = -solverParams.sourceCoeffs[1]*field.u[1][n]
+            + solverParams.fluxCoeffs[0]*solverParams.sourceCoeffs[3]*H
+            - solverParams.sourceCoeffs[4]*speedNorm*field.u[2][n]
+            /(solverParams.sourceCoeffs[0]*H);
+    }
+}
+
+
 // see .hpp file for description
 void sourceShallowCstGradCstFrict(Field& field, const SolverParams& solverParams)
 {
-    field.s[0].setZero();
+    sourceCstGradCstFrict(field, solverParams, 0, field.u[0].size());
+}
 
-    field.s[1] = solverParams.sourceCoeffs[1]*field.u[2]
-            + solverParams.fluxCoeffs[0]*solverParams.sourceCoeffs[2]*field.u[0]
-            - solverParams.sourceCoeffs[4]*field.u[1]/solverParams.sourceCoeffs[0];
 
-    field.s[2] = -solverParams.sourceCoeffs[1]*field.u[1]
-            + solverParams.fluxCoeffs[0]*solverParams.sourceCoeffs[3]*field.u[0]
-            - solverParams.sourceCoeffs[4]*field.u[2]/solverParams.sourceCoeffs[0];
+// see .hpp file for description
+void sourceShallowCstGradQuadFrict(Field& field, const SolverParams& solverParams)
+{
+    sourceCstGradQuadFrict(field, solverParams, 0, field.u[0].size());
 }
 
 
 // see .hpp file for description
-void sourceShallowCstGradQuadFrict(Field& field, const SolverParams& solverParams)
+void localSourceShallowCstGradCstFrict(const Mesh& mesh, Field& field,
+                                       const SolverParams& solverParams,
+                                       const std::vector<unsigned int>& elements,
+                                       unsigned int nElements)
 {
-    Eigen::VectorXd speedNorm(field.u[0].size());
-    speedNorm = field.u[1].array()*field.u[1].array()
-                + field.u[2].array()*field.u[2].array();
-    speedNorm = speedNorm.array().sqrt();
-    speedNorm = speedNorm.array()/field.u[0].array();
+    const SolverMesh& solverMesh = mesh.solverMesh;
+
+    #if defined(_OPENMP)
+        #pragma omp parallel for default(none) \
+            shared(field, solverMesh, solverParams, elements, nElements)
+    #endif
+    for(unsigned int e = 0 ; e < nElements ; ++e)
+    {
+        unsigned int elm = elements[e];
+        sourceCstGradCstFrict(field, solverParams, solverMesh.elmOffsetInU[elm],
+                              solverMesh.typeNSF[solverMesh.elmType[elm]]);
+    }
+}
+
+
+// see .hpp file for description
+void localSourceShallowCstGradQuadFrict(const Mesh& mesh, Field& field,
+                                        const SolverParams& solverParams,
+                                        const std::vector<unsigned int>& elements,
+                                        unsigned int nElements)
+{
+    const SolverMesh& solverMesh = mesh.solverMesh;
+
+    #if defined(_OPENMP)
+        #pragma omp parallel for default(none) \
+            shared(field, solverMesh, solverParams, elements, nElements)
+    #endif
+    for(unsigned int e = 0 ; e < nElements ; ++e)
+    {
+        unsigned int elm = elements[e];
+        sourceCstGradQuadFrict(field, solverParams, solverMesh.elmOffsetInU[elm],
+                               solverMesh.typeNSF[solverMesh.elmType[elm]]);
+    }
+}
+
+
+// see .hpp file for description
+void implicitSourceShallowCstGradCstFrict(Field& field, double a,
+                                          const SolverParams& solverParams)
+{
+    double f = solverParams.sourceCoeffs[1];
+    double k = solverParams.sourceCoeffs[4]/solverParams.sourceCoeffs[0];
+    double g = solverParams.fluxCoeffs[0];
+
+    // (1 + a*k)*Hu - a*f*Hv = rhsU and a*f*Hu + (1 + a*k)*Hv = rhsV
+    double diag = 1 + a*k;
+    double det = diag*diag + a*f*a*f;
+
+    Eigen::VectorXd rhsU = field.u[1] + a*g*solverParams.sourceCoeffs[2]*field.u[0];
+    Eigen::VectorXd rhsV = field.u[2] + a*g*solverParams.sourceCoeffs[3]*field.u[0];
+
+    field.u[1] = (diag*rhsU + a*f*rhsV)/det;
+    field.u[2] = (diag*rhsV - a*f*rhsU)/det;
+}
+
+
+// see .hpp file for description
+void implicitSourceShallowCstGradQuadFrict(Field& field, double a,
+                                           const SolverParams& solverParams)
+{
+    double f = solverParams.sourceCoeffs[1];
+    double g = solverParams.fluxCoeffs[0];
+
+    for(unsigned int n = 0 ; n < field.u[0].size() ; ++n)
+    {
+        double H = field.u[0][n];
+        double kappa = solverParams.sourceCoeffs[4]/(solverParams.sourceCoeffs[0]*H*H);
+
+        double rhsU = field.u[1][n] + a*g*solverParams.sourceCoeffs[2]*H;
+        double rhsV = field.u[2][n] + a*g*solverParams.sourceCoeffs[3]*H;
+
+        // Newton iterations on r(q) = q - a*(C*q - kappa*|q|*q) - rhs, C being
+        // the Coriolis rotation, from the explicit value
+        double qU = rhsU, qV = rhsV;
+        for(unsigned short it = 0 ; it < 20 ; ++it)
+        {
+            double norm = std::sqrt(qU*qU + qV*qV);
+
+            double rU = qU - a*(f*qV - kappa*norm*qU) - rhsU;
+            double rV = qV - a*(-f*qU - kappa*norm*qV) - rhsV;
+
+            // Jacobian I - a*(C - kappa*(|q|*I + q*q^T/|q|))
+            double jUU = 1 + a*kappa*norm, jVV = jUU;
+            double jUV = -a*f, jVU = a*f;
+            if(norm > 0)
+            {
+                jUU += a*kappa*qU*qU/norm;
+                jVV += a*kappa*qV*qV/norm;
+                jUV += a*kappa*qU*qV/norm;
+                jVU += a*kappa*qU*qV/norm;
+            }
+            double det = jUU*jVV - jUV*jVU;
 
-    field.s[0].setZero();
+            double dU = (jVV*rU - jUV*rV)/det;
+            double dV = (jUU*rV - jVU*rU)/det;
+            qU -= dU;
+            qV -= dV;
 
-    field.s[1] = solverParams.sourceCoeffs[1]*field.u[2].array()
-        + solverParams.fluxCoeffs[0]*solverParams.sourceCoeffs[2]*field.u[0].array()
-        - solverParams.sourceCoeffs[4]*speedNorm.array()*field.u[1].array()
-        /(solverParams.sourceCoeffs[0]*field.u[0].array());
+            if(std::abs(dU) + std::abs(dV) <= 1e-14*(std::abs(qU) + std::abs(qV)))
+                break;
+        }
 
-    field.s[2] = -solverParams.sourceCoeffs[1]*field.u[1].array()
-        + solverParams.fluxCoeffs[0]*solverParams.sourceCoeffs[3]*field.u[0].array()
-        - solverParams.sourceCoeffs[4]*speedNorm.array()*field.u[2].array()
-        /(solverParams.sourceCoeffs[0]*field.u[0].array());
+        field.u[1][n] = qU;
+        field.u[2][n] = qV;
+    }
 }
@@ -24,4 +24,68 @@
 void sourceShallowCstGradQuadFrict(Field& field, const SolverParams& solverParams);
 
 
+/**
+ * \brief Function that computes the source term of sourceShallowCstGradCstFrict
+ * at the nodes of some elements only (local time stepping, see
+ * localTimeStepping.hpp).
+ * \param mesh The mesh of the problem.
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param solverParams Structure containing the solver's parameters.
+ * \param elements List of elements whose source term is computed.
+ * \param nElements Number of elements taken at the beginning of the list.
+ */
+void localSourceShallowCstGradCstFrict(const Mesh& mesh, Field& field,
+                                       const SolverParams& solverParams,
+                                       const std::vector<unsigned int>& elements,
+                                       unsigned int nElements);
+
+
+/**
+ * \brief Function that computes the source term of sourceShallowCstGradQuadFrict
+ * at the nodes of some elements only (local time stepping, see
+ * localTimeStepping.hpp).
+ * \param mesh The mesh of the problem.
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param solverParams Structure containing the solver's parameters.
+ * \param elements List of elements whose source term is computed.
+ * \param nElements Number of elements taken at the beginning of the list.
+ */
+void localSourceShallowCstGradQuadFrict(const Mesh& mesh, Field& field,
+                                        const SolverParams& solverParams,
+                                        const std::vector<unsigned int>& elements,
+                                        unsigned int nElements);
+
+
+/**
+ * \brief Function that solves the implicit stage of the source term of
+ * sourceShallowCstGradCstFrict, u - a*s(u) = u*, at each node, u* being the
+ * explicit stage value (exact solve of the linear 2x2 system of the momentum, H
+ * being unchanged).
+ * \param field Structure containing all the information about the computed
+ * unknowns (field.u is the explicit stage value u* on input, then the
+ * solution u).
+ * \param a Coefficient of the source term (time step times the diagonal
+ * coefficient of the IMEX scheme).
+ * \param solverParams Structure containing the solver's parameters.
+ */
+void implicitSourceShallowCstGradCstFrict(Field& field, double a,
+                                          const SolverParams& solverParams);
+
+
+/**
+ * \brief Function that solves the implicit stage of the source term of
+ * sourceShallowCstGradQuadFrict, u - a*s(u) = u*, at each node, u* being the
+ * explicit stage value (Newton iterations on the 2x2 system of the momentum, H
+ * being unchanged).
+ * \param field Structure containing all the information about the computed
+ * unknowns (field.u is the explicit stage value u* on input, then the
+ * solution u).
+ * \param a Coefficient of the source term (time step times the diagonal
+ * coefficient of the IMEX scheme).
+ * \param solverParams Structure containing the solver's parameters.
+ */
+void implicitSourceShallowCstGradQuadFrict(Field& field, double a,
+                                           const SolverParams& solverParams);
+
+
 #endif // shallow_source_hpp_included
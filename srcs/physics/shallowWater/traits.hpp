@@ -0,0 +1,101 @@
+#ifndef shallow_traits_hpp_included
+#define shallow_traits_hpp_included
+
+#include <cmath>
+#include <vector>
+
+
+/**
+ * \struct ShallowWater
+ * \brief Pointwise physics of the shallow water equations, the unknowns being
+ * [H, H*u, H*v]. The numerical flux kernels are instantiated with it.
+ */
+struct ShallowWater
+{
+    static constexpr unsigned short nUnknowns = 3; /**< Number of unknowns */
+
+    /**
+     * \brief Compute the physical flux at one node.
+     * \param u Unknowns at the node.
+     * \param F Physical flux at the node (F[dim][unk]).
+     * \param fluxCoeffs Coefficients of the physical flux (gravity).
+     */
+    static void flux(const double* u, double F[2][nUnknowns],
+                     const std::vector<double>& fluxCoeffs)
+    {
+        // gravity parameter
+        double g = fluxCoeffs[0];
+
+        // the physical flux is given by
+        //  Fx = [H*u,   H*u^2 + g*H^2/2,    H*u*v       ]
+        //  Fy = [H*v,   H*u*v,              H*v^2 + g*H ]
+        F[0][0] = u[1];
+        F[1][0] = u[2];
+
+        F[0][1] = u[1]*u[1]/u[0] + g/2*u[0]*u[0];
+        F[0][2] = u[1]*u[2]/u[0];
+
+        F[1][1] = u[1]*u[2]/u[0];
+        F[1][2] = u[2]*u[2]/u[0] + g/2*u[0]*u[0];
+    }
+
+    /**
+     * \brief Compute the absolute value of the largest eigenvalue of the flux
+     * Jacobian along a normal (for the LF flux).
+     * \param u Unknowns at the node.
+     * \param normal Normal along which the eigenvalue is computed.
+     * \param fluxCoeffs Coefficients of the physical flux (gravity).
+     * \return |u.n| + sqrt(g*H).
+     */
+    static double maxEigenvalue(const double* u, const double* normal,
+                                const std::vector<double>& fluxCoeffs)
+    {
+        double g = fluxCoeffs[0];
+        double lambda = (u[1]*normal[0] + u[2]*normal[1])/u[0];
+
+        return (lambda >= 0) ? lambda + std::sqrt(g*u[0]) :
+                               -lambda + std::sqrt(g*u[0]);
+    }
+
+    /**
+     * \brief Compute the Roe averaged celerity and the (limited) Froude number
+     * along a normal, between two states.
+     * \param uIn Unknowns inside the element.
+     * \param uOut Unknowns outside the element.
+     * \param normal Normal of the edge.
+     * \param fluxCoeffs Coefficients of the physical flux (gravity).
+     * \param cRoe Roe averaged celerity.
+     * \param Fr Froude number, limited to [-1, 1].
+     */
+    static void roeAverages(const double* uIn, const double* uOut,
+                            const double* normal,
+                            const std::vector<double>& fluxCoeffs,
+                            double& cRoe, double& Fr)
+    {
+        double g = fluxCoeffs[0];
+
+        // compute the Roe averages
+        double hJSqrt = std::sqrt(uIn[0]);
+        double hFrontJSqrt = std::sqrt(uOut[0]);
+
+        double uRoe = ((uIn[1]/uIn[0])*hJSqrt + (uOut[1]/uOut[0])*hFrontJSqrt)
+                    /(hJSqrt + hFrontJSqrt);
+        double vRoe = ((uIn[2]/uIn[0])*hJSqrt + (uOut[2]/uOut[0])*hFrontJSqrt)
+                    /(hJSqrt + hFrontJSqrt);
+
+        cRoe = std::sqrt(g*(uIn[0] + uOut[0])/2);
+
+        // compute the (limited) Froude number
+        Fr = (uRoe*normal[0] + vRoe*normal[1])/cRoe;
+        if(Fr < -1.0)
+        {
+            Fr = -1.0;
+        }
+        else if(Fr > 1.0)
+        {
+            Fr = 1.0;
+        }
+    }
+};
+
+#endif // shallow_traits_hpp_included
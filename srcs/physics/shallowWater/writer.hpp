@@ -15,7 +15,7 @@
  * \param modelName Name of the model.
  * \param nbreStep Current time step.
  * \param t Current simulation physical time.
- * \param field Structure that contains all the main variables.
+ * \param u Solution fields to write (one vector per unknown).
  * \param fluxCoeffs Coefficient of the physical flux.
  * \param whatToWrite Vector containing boolean describing which unknown to write.
  * \param viewTags Vector containing the rag of the different writing data's.
@@ -24,7 +24,8 @@ void writeShallow(std::vector<std::vector<double>>& uDisplay,
                   const std::vector<unsigned int>& elementNumNodes,
                   const std::vector<std::size_t>& elementTags,
                   const std::string& modelName, unsigned int nbreStep, double t,
-                  const Field& field, const std::vector<double>& fluxCoeffs,
+                  const std::vector<Eigen::VectorXd>& u,
+                  const std::vector<double>& fluxCoeffs,
                   const std::vector<bool>& whatToWrite, std::vector<int>& viewTags);
 
 #endif /* shallow_writer_hpp_included */
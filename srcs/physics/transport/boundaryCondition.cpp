@@ -5,9 +5,9 @@
 #include <iostream>
 
 // see .hpp file for description
-void sinusTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void sinusTransport(std::vector<double>& uAtIBC, const double* pos,
            double t, const Field& field, unsigned int indexJ,
-           const std::vector<double>& edgeNormal,
+           const double* edgeNormal,
            const std::vector<double>& coeffs,
            const std::vector<double>& fluxCoeffs)
 {
@@ -20,9 +20,9 @@ void sinusTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
 
 
 // see .hpp file for description
-void gaussianTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussianTransport(std::vector<double>& uAtIBC, const double* pos,
            double t, const Field& field, unsigned int indexJ,
-           const std::vector<double>& edgeNormal,
+           const double* edgeNormal,
            const std::vector<double>& coeffs,
            const std::vector<double>& fluxCoeffs)
 {
@@ -35,9 +35,9 @@ void gaussianTransport(std::vector<double>& uAtIBC, const std::vector<double>& p
 
 
 // see .hpp file for description
-void freeTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void freeTransport(std::vector<double>& uAtIBC, const double* pos,
                    double t, const Field& field, unsigned int indexJ,
-                   const std::vector<double>& edgeNormal,
+                   const double* edgeNormal,
                    const std::vector<double>& coeffs,
                    const std::vector<double>& fluxCoeffs)
 {
@@ -52,15 +52,14 @@ void freeTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
 
 
 // see .hpp file for description
-void gaussian2DTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian2DTransport(std::vector<double>& uAtIBC, const double* pos,
                         double t, const Field& field, unsigned int indexJ,
-                        const std::vector<double>& edgeNormal,
+                        const double* edgeNormal,
                         const std::vector<double>& coeffs,
                          const std::vector<double>& fluxCoeffs)
 {
     // check that there is enough coefficients
     assert(coeffs.size() == 6);
-    assert(pos.size() == 3);
 
     // compute a 2D gaussian
     double X = (pos[0]-coeffs[1])*(pos[0]-coeffs[1])/(2*coeffs[2]);
@@ -8,7 +8,7 @@
  * \brief Compute a wave of the shape A*sin(2*pi*nu*t + phi) -- for the pure
  * transport case.
  * \param uAtIBC Value of the BC unknowns at (x, y, z, t).
- * \param pos Node position.
+ * \param pos Node position (3 coordinates).
  * \param t Current time.
  * \param field Structure containing the current solution.
  * \param indexJ Index of the node corresponding to the boundary in the field structure.
@@ -16,9 +16,9 @@
  * coeffs[2] = phi.
  * \param fluxCoeffs Coefficients of the physical fluxes.
  */
-void sinusTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void sinusTransport(std::vector<double>& uAtIBC, const double* pos,
            double t, const Field& field, unsigned int indexJ,
-           const std::vector<double>& edgeNormal,
+           const double* edgeNormal,
            const std::vector<double>& coeffs,
            const std::vector<double>& fluxCoeffs);
 
@@ -26,7 +26,7 @@ void sinusTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
  * \brief Compute a gaussian: A*exp(-(t-t_peak)^2/(2*var)) -- for the pure transport
  * case.
  * \param uAtIBC Value of the BC unknowns at (x, y, z, t).
- * \param pos Node position.
+ * \param pos Node position (3 coordinates).
  * \param t Current time.
  * \param field Structure containing the current solution.
  * \param indexJ Index of the node corresponding to the boundary in the field structure.
@@ -34,9 +34,9 @@ void sinusTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
  * coeffs[2] = var.
  * \param fluxCoeffs Coefficients of the physical fluxes.
  */
-void gaussianTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussianTransport(std::vector<double>& uAtIBC, const double* pos,
               double t, const Field& field, unsigned int indexJ,
-              const std::vector<double>& edgeNormal,
+              const double* edgeNormal,
               const std::vector<double>& coeffs,
               const std::vector<double>& fluxCoeffs);
 
@@ -44,7 +44,7 @@ void gaussianTransport(std::vector<double>& uAtIBC, const std::vector<double>& p
  * \brief Compute a 2D gaussian:  A*exp(-(x-x0)^2/(2*var_y)-(y-y0)^2/(2*var_y)) --
  * for the pure transport case.
  * \param uAtIBC Value of the BC unknowns at (x, y, z, t).
- * \param pos Node position.
+ * \param pos Node position (3 coordinates).
  * \param t Current time.
  * \param field Structure containing the current solution.
  * \param indexJ Index of the node corresponding to the boundary in the field structure.
@@ -52,9 +52,9 @@ void gaussianTransport(std::vector<double>& uAtIBC, const std::vector<double>& p
  * coeffs[2] = var_x, coeffs[3] = y_0, coeffs[4] = var_y.
  * \param fluxCoeffs Coefficients of the physical fluxes.
  */
-void gaussian2DTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void gaussian2DTransport(std::vector<double>& uAtIBC, const double* pos,
                          double t, const Field& field, unsigned int indexJ,
-                         const std::vector<double>& edgeNormal,
+                         const double* edgeNormal,
                          const std::vector<double>& coeffs,
                          const std::vector<double>& fluxCoeffs);
 
@@ -62,16 +62,16 @@ void gaussian2DTransport(std::vector<double>& uAtIBC, const std::vector<double>&
 /**
  * \brief Compute a physical opening -- for the pure transport case.
  * \param uAtIBC Value of the BC unknowns at (x, y, z, t).
- * \param pos Node position.
+ * \param pos Node position (3 coordinates).
  * \param t Current time.
  * \param field Structure containing the current solution.
  * \param indexJ Index of the node corresponding to the boundary in the field structure.
  * \param coeffs Coefficient (not used here).
  * \param fluxCoeffs Coefficients of the physical fluxes.
  */
-void freeTransport(std::vector<double>& uAtIBC, const std::vector<double>& pos,
+void freeTransport(std::vector<double>& uAtIBC, const double* pos,
                    double t, const Field& field, unsigned int indexJ,
-                   const std::vector<double>& edgeNormal,
+                   const double* edgeNormal,
                    const std::vector<double>& coeffs,
                    const std::vector<double>& fluxCoeffs);
 
@@ -8,11 +8,8 @@
 /**
  * \brief Function that computes the physical flux for a pure transport.
  * \param field Structure containing all the information about the computed unknowns.
- * \param partialField Structure containing temporary unknowns.
  * \param solverParams Structure containing the solver's parameters.
- * \param boundary Boolean that specifies if we consider a boundary (1) or not (0).
  */
-void fluxTransport(Field& field, PartialField& partialField,
-					const SolverParams& solverParams, bool boundary);
+void fluxTransport(Field& field, const SolverParams& solverParams);
 
 #endif // transport_flux_hpp_included
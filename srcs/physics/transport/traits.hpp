@@ -0,0 +1,46 @@
+#ifndef transport_traits_hpp_included
+#define transport_traits_hpp_included
+
+#include <cmath>
+#include <vector>
+
+
+/**
+ * \struct Transport
+ * \brief Pointwise physics of the transport equation of one scalar at a constant
+ * velocity. The numerical flux kernels are instantiated with it.
+ */
+struct Transport
+{
+    static constexpr unsigned short nUnknowns = 1; /**< Number of unknowns */
+
+    /**
+     * \brief Compute the physical flux at one node.
+     * \param u Unknowns at the node.
+     * \param F Physical flux at the node (F[dim][unk]).
+     * \param fluxCoeffs Coefficients of the physical flux (velocity).
+     */
+    static void flux(const double* u, double F[2][nUnknowns],
+                     const std::vector<double>& fluxCoeffs)
+    {
+        // the physical flux is F = a*Q", where "a" is a 2D vector
+        F[0][0] = fluxCoeffs[0]*u[0];
+        F[1][0] = fluxCoeffs[1]*u[0];
+    }
+
+    /**
+     * \brief Compute the absolute value of the eigenvalue of the flux Jacobian
+     * along a normal (for the LF flux).
+     * \param u Unknowns at the node.
+     * \param normal Normal along which the eigenvalue is computed.
+     * \param fluxCoeffs Coefficients of the physical flux (velocity).
+     * \return |a.n|.
+     */
+    static double maxEigenvalue(const double* u, const double* normal,
+                                const std::vector<double>& fluxCoeffs)
+    {
+        return std::fabs(fluxCoeffs[0]*normal[0] + fluxCoeffs[1]*normal[1]);
+    }
+};
+
+#endif // transport_traits_hpp_included
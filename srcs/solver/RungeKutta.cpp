@@ -1,8 +1,133 @@
+#include <cmath>
+#include <iostream>
 #include "RungeKutta.hpp"
 
+
+/**
+ * \brief Compute one step of a stiffly accurate IMEX Runge-Kutta method whose
+ * first stage is explicit. The explicit part of the increment is usedF without
+ * the source term (DeltaU - s), the implicit part is the source term s. The
+ * right-hand side of each following stage is accumulated in its register as soon
+ * as a stage is computed, so that only nStages - 1 registers are needed.
+ * \param t Current time.
+ * \param field Field that contains all the main variables.
+ * \param matrix Structure that contains the matrices of the DG method.
+ * \param mesh Mesh representing the domain.
+ * \param solverParams Parameters of the solver.
+ * \param usedF pointer to the function Fweak or Fstrong
+ * \param nStages Number of stages.
+ * \param AE Explicit coefficients (row major, nStages x nStages).
+ * \param AI Implicit coefficients (row major, nStages x nStages).
+ * \param c Time of each stage (fraction of the time step).
+ */
+static void IMEXRK(double t, Field& field, const Matrix& matrix,
+                   const Mesh& mesh, const SolverParams& solverParams,
+                   UsedF usedF, unsigned short nStages, const double* AE,
+                   const double* AI, const double* c)
+{
+    double h = solverParams.timeStep;
+
+    for(unsigned short i = 0 ; i < nStages ; ++i)
+    {
+        if(i > 0)
+        {
+            // the stage solution is the implicit solve of its right-hand side
+            field.u.swap(field.registers[i - 1]);
+            solverParams.implicitSource(field, AI[i*nStages + i]*h, solverParams);
+
+            // stiffly accurate: the last stage is the new solution
+            if(i == nStages - 1)
+                return;
+        }
+
+        usedF(t + c[i]*h, field, matrix, mesh, solverParams);
+
+        for(unsigned short k = i + 1 ; k < nStages ; ++k)
+        {
+            std::vector<Eigen::VectorXd>& rhs = field.registers[k - 1];
+            double aE = AE[k*nStages + i]*h;
+            double aI = AI[k*nStages + i]*h;
+
+            for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+            {
+                if(i == 0)
+                    rhs[unk] = field.u[unk];
+
+                rhs[unk] += aE*(field.DeltaU[unk] - field.s[unk])
+                            + aI*field.s[unk];
+            }
+        }
+    }
+}
+
+// see .hpp file for description
+bool getIntegScheme(const std::string& timeIntType, IntegScheme& integScheme,
+                    unsigned short& numRegisters)
+{
+    if(timeIntType == "RK1")
+    {
+        integScheme = RK1;
+        numRegisters = 0;
+    }
+    else if(timeIntType == "RK2")
+    {
+        integScheme = RK2;
+        numRegisters = 1;
+    }
+    else if(timeIntType == "RK3")
+    {
+        integScheme = RK3;
+        numRegisters = 2;
+    }
+    else if(timeIntType == "RK4")
+    {
+        integScheme = RK4;
+        numRegisters = 2;
+    }
+    else if(timeIntType == "LSRK54")
+    {
+        integScheme = LSRK54;
+        numRegisters = 1;
+    }
+    else if(timeIntType == "SSPRK3")
+    {
+        integScheme = SSPRK3;
+        numRegisters = 1;
+    }
+    else if(timeIntType == "SSPRK54")
+    {
+        integScheme = SSPRK54;
+        numRegisters = 2;
+    }
+    else if(timeIntType == "SSPRK104")
+    {
+        integScheme = SSPRK104;
+        numRegisters = 1;
+    }
+    else if(timeIntType == "ARS222")
+    {
+        integScheme = ARS222;
+        numRegisters = 2;
+    }
+    else if(timeIntType == "ARS443")
+    {
+        integScheme = ARS443;
+        numRegisters = 4;
+    }
+    else
+    {
+        std::cerr << "Unknown time integration scheme " << timeIntType
+                  << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
 // see .hpp file for prototype
 void RK1(double t, Field& field, const Matrix& matrix,
-         const Mesh& mesh, const SolverParams& solverParams, Field& temp, UsedF usedF)
+         const Mesh& mesh, const SolverParams& solverParams, UsedF usedF)
 {
     usedF(t, field, matrix, mesh, solverParams);
     for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
@@ -12,88 +137,273 @@ void RK1(double t, Field& field, const Matrix& matrix,
 
 // see .hpp file for prototype
 void RK2(double t, Field& field, const Matrix& matrix,
-         const Mesh& mesh, const SolverParams& solverParams, Field& temp, UsedF usedF)
+         const Mesh& mesh, const SolverParams& solverParams, UsedF usedF)
 {
+    double h = solverParams.timeStep;
+    std::vector<Eigen::VectorXd>& u0 = field.registers[0];
+
+    usedF(t, field, matrix, mesh, solverParams);
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        u0[unk] = field.u[unk] + field.DeltaU[unk]*(h/2);
+
+    // field.u becomes the stage solution, u0 the solution at t
+    field.u.swap(u0);
+
+    usedF(t + h/2, field, matrix, mesh, solverParams);
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        field.u[unk] = u0[unk] + field.DeltaU[unk]*h;
+}
 
+
+// see .hpp file for prototype
+void RK3(double t, Field& field, const Matrix& matrix,
+         const Mesh& mesh, const SolverParams& solverParams, UsedF usedF)
+{
     double h = solverParams.timeStep;
+    std::vector<Eigen::VectorXd>& u0 = field.registers[0];
+    std::vector<Eigen::VectorXd>& k = field.registers[1];
 
-    usedF(t, temp, matrix, mesh, solverParams);
+    usedF(t, field, matrix, mesh, solverParams);
     for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
     {
-        field.k1[unk] = temp.DeltaU[unk]*h;
-        temp.u[unk] = field.u[unk] + field.k1[unk]/2;
+        k[unk] = field.DeltaU[unk]*h;
+        u0[unk] = field.u[unk] + k[unk]/2;
     }
 
-    usedF(t + h/2, temp, matrix, mesh, solverParams);
+    // field.u becomes the stage solution, u0 the solution at t
+    field.u.swap(u0);
+
+    usedF(t + h/2, field, matrix, mesh, solverParams);
     for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
     {
-        field.k2[unk] = temp.DeltaU[unk]*h;
-        field.u[unk] += field.k2[unk];
+        field.u[unk] = u0[unk] - k[unk] + 2*(field.DeltaU[unk]*h);
+        k[unk] += 4*(field.DeltaU[unk]*h);
     }
+
+    usedF(t + h, field, matrix, mesh, solverParams);
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        field.u[unk] = u0[unk] + (k[unk] + field.DeltaU[unk]*h)/6;
 }
 
 
 // see .hpp file for prototype
-void RK3(double t, Field& field, const Matrix& matrix,
-         const Mesh& mesh, const SolverParams& solverParams, Field& temp, UsedF usedF)
+void RK4(double t, Field& field, const Matrix& matrix,
+         const Mesh& mesh, const SolverParams& solverParams, UsedF usedF)
 {
     double h = solverParams.timeStep;
+    std::vector<Eigen::VectorXd>& u0 = field.registers[0];
+    std::vector<Eigen::VectorXd>& k = field.registers[1];
+
+    usedF(t, field, matrix, mesh, solverParams);
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+    {
+        k[unk] = field.DeltaU[unk]*h;
+        u0[unk] = field.u[unk] + k[unk]/2;
+    }
 
-    usedF(t, temp, matrix, mesh, solverParams);
+    // field.u becomes the stage solution, u0 the solution at t
+    field.u.swap(u0);
+
+    usedF(t + h/2, field, matrix, mesh, solverParams);
     for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
     {
-        field.k1[unk] = temp.DeltaU[unk]*h;
-        temp.u[unk] = field.u[unk] + field.k1[unk]/2;
+        field.u[unk] = u0[unk] + (field.DeltaU[unk]*h)/2;
+        k[unk] += 2*(field.DeltaU[unk]*h);
     }
 
-    usedF(t + h/2, temp, matrix, mesh, solverParams);
+    usedF(t + h/2, field, matrix, mesh, solverParams);
     for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
     {
-        field.k2[unk] = temp.DeltaU[unk]*h;
-        temp.u[unk] = field.u[unk] - field.k1[unk] + 2*field.k2[unk];
+        field.u[unk] = u0[unk] + field.DeltaU[unk]*h;
+        k[unk] += 2*(field.DeltaU[unk]*h);
     }
 
-    usedF(t + h, temp, matrix, mesh, solverParams);
-    for(unsigned short unk = 0 ; unk < 3 ; ++unk)
+    usedF(t + h, field, matrix, mesh, solverParams);
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        field.u[unk] = u0[unk] + (k[unk] + field.DeltaU[unk]*h)/6;
+}
+
+
+// see .hpp file for prototype
+void LSRK54(double t, Field& field, const Matrix& matrix,
+            const Mesh& mesh, const SolverParams& solverParams, UsedF usedF)
+{
+    // Carpenter and Kennedy, NASA TM-109112 (1994), solution 3
+    static const double A[5] = {0.0,
+                                -567301805773.0/1357537059087.0,
+                                -2404267990393.0/2016746695238.0,
+                                -3550918686646.0/2091501179385.0,
+                                -1275806237668.0/842570457699.0};
+    static const double B[5] = {1432997174477.0/9575080441755.0,
+                                5161836677717.0/13612068292357.0,
+                                1720146321549.0/2090206949498.0,
+                                3134564353537.0/4481467310338.0,
+                                2277821191437.0/14882151754819.0};
+    static const double C[5] = {0.0,
+                                1432997174477.0/9575080441755.0,
+                                2526269341429.0/6820363962896.0,
+                                2006345519317.0/3224310063776.0,
+                                2802321613138.0/2924317926251.0};
+
+    double h = solverParams.timeStep;
+    std::vector<Eigen::VectorXd>& du = field.registers[0];
+
+    for(unsigned short stage = 0 ; stage < 5 ; ++stage)
     {
-        field.k3[unk] = temp.DeltaU[unk]*h;
-        field.u[unk] += (field.k1[unk] + 4*field.k2[unk] + field.k3[unk])/6;
+        usedF(t + C[stage]*h, field, matrix, mesh, solverParams);
+        for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        {
+            if(stage == 0)
+                du[unk] = field.DeltaU[unk]*h;
+            else
+                du[unk] = A[stage]*du[unk] + field.DeltaU[unk]*h;
+
+            field.u[unk] += B[stage]*du[unk];
+        }
     }
 }
 
 
 // see .hpp file for prototype
-void RK4(double t, Field& field, const Matrix& matrix,
-         const Mesh& mesh, const SolverParams& solverParams, Field& temp, UsedF usedF)
+void SSPRK3(double t, Field& field, const Matrix& matrix,
+            const Mesh& mesh, const SolverParams& solverParams, UsedF usedF)
 {
     double h = solverParams.timeStep;
+    std::vector<Eigen::VectorXd>& u0 = field.registers[0];
 
-    usedF(t, temp, matrix, mesh, solverParams);
+    usedF(t, field, matrix, mesh, solverParams);
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        u0[unk] = field.u[unk] + field.DeltaU[unk]*h;
+
+    // field.u becomes the stage solution, u0 the solution at t
+    field.u.swap(u0);
+
+    usedF(t + h, field, matrix, mesh, solverParams);
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        field.u[unk] = 0.75*u0[unk] + 0.25*(field.u[unk] + field.DeltaU[unk]*h);
+
+    usedF(t + h/2, field, matrix, mesh, solverParams);
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        field.u[unk] = (u0[unk] + 2*(field.u[unk] + field.DeltaU[unk]*h))/3;
+}
+
+
+// see .hpp file for prototype
+void SSPRK54(double t, Field& field, const Matrix& matrix,
+             const Mesh& mesh, const SolverParams& solverParams, UsedF usedF)
+{
+    // Spiteri and Ruuth, SIAM J. Numer. Anal. 40 (2002), Shu-Osher form
+    double h = solverParams.timeStep;
+    std::vector<Eigen::VectorXd>& u0 = field.registers[0];
+    std::vector<Eigen::VectorXd>& r = field.registers[1];
+
+    usedF(t, field, matrix, mesh, solverParams);
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        u0[unk] = field.u[unk] + 0.391752226571890*h*field.DeltaU[unk];
+
+    // field.u becomes the stage solution, u0 the solution at t
+    field.u.swap(u0);
+
+    usedF(t + 0.391752226571890*h, field, matrix, mesh, solverParams);
     for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
     {
-        field.k1[unk] = temp.DeltaU[unk]*h;
-        temp.u[unk] = field.u[unk] + field.k1[unk]/2;
+        field.u[unk] = 0.444370493651235*u0[unk] + 0.555629506348765*field.u[unk]
+                       + 0.368410593050371*h*field.DeltaU[unk];
+        r[unk] = 0.517231671970585*field.u[unk];
     }
 
-    usedF(t + h/2, temp, matrix, mesh, solverParams);
+    usedF(t + 0.586079689311540*h, field, matrix, mesh, solverParams);
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        field.u[unk] = 0.620101851488403*u0[unk] + 0.379898148511597*field.u[unk]
+                       + 0.251891774271694*h*field.DeltaU[unk];
+
+    usedF(t + 0.474542363121400*h, field, matrix, mesh, solverParams);
     for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
     {
-        field.k2[unk] = temp.DeltaU[unk]*h;
-        temp.u[unk] = field.u[unk] + field.k2[unk]/2;
+        r[unk] += 0.096059710526147*field.u[unk]
+                  + 0.063692468666290*h*field.DeltaU[unk];
+        field.u[unk] = 0.178079954393132*u0[unk] + 0.821920045606868*field.u[unk]
+                       + 0.544974750228521*h*field.DeltaU[unk];
     }
 
-    usedF(t + h/2, temp, matrix, mesh, solverParams);
+    usedF(t + 0.935010630967653*h, field, matrix, mesh, solverParams);
     for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        field.u[unk] = r[unk] + 0.386708617503269*field.u[unk]
+                       + 0.226007483236906*h*field.DeltaU[unk];
+}
+
+
+// see .hpp file for prototype
+void SSPRK104(double t, Field& field, const Matrix& matrix,
+              const Mesh& mesh, const SolverParams& solverParams, UsedF usedF)
+{
+    // Ketcheson, SIAM J. Sci. Comput. 30 (2008), low-storage implementation
+    double h = solverParams.timeStep;
+    std::vector<Eigen::VectorXd>& q2 = field.registers[0];
+
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        q2[unk] = field.u[unk];
+
+    for(unsigned short stage = 0 ; stage < 5 ; ++stage)
     {
-        field.k3[unk] = temp.DeltaU[unk]*h;
-        temp.u[unk] = field.u[unk] + field.k3[unk];
+        usedF(t + stage*h/6, field, matrix, mesh, solverParams);
+        for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+            field.u[unk] += field.DeltaU[unk]*(h/6);
     }
 
-    usedF(t + h, temp, matrix, mesh, solverParams);
     for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
     {
-        field.k4[unk] = temp.DeltaU[unk]*h;
-        field.u[unk] += (field.k1[unk] + 2*field.k2[unk] + 2*field.k3[unk]
-                        + field.k4[unk])/6;
+        q2[unk] = (q2[unk] + 9*field.u[unk])/25;
+        field.u[unk] = 15*q2[unk] - 5*field.u[unk];
+    }
+
+    for(unsigned short stage = 5 ; stage < 9 ; ++stage)
+    {
+        usedF(t + (stage - 3)*h/6, field, matrix, mesh, solverParams);
+        for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+            field.u[unk] += field.DeltaU[unk]*(h/6);
     }
+
+    usedF(t + h, field, matrix, mesh, solverParams);
+    for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
+        field.u[unk] = q2[unk] + 0.6*field.u[unk] + 0.1*h*field.DeltaU[unk];
+}
+
+
+// see .hpp file for prototype
+void ARS222(double t, Field& field, const Matrix& matrix,
+            const Mesh& mesh, const SolverParams& solverParams, UsedF usedF)
+{
+    static const double gamma = 1 - 1/std::sqrt(2.0);
+    static const double delta = 1 - 1/(2*gamma);
+
+    static const double AE[9] = {0,         0,           0,
+                                 gamma,     0,           0,
+                                 delta,     1 - delta,   0};
+    static const double AI[9] = {0,         0,           0,
+                                 0,         gamma,       0,
+                                 0,         1 - gamma,   gamma};
+    static const double c[3] = {0, gamma, 1};
+
+    IMEXRK(t, field, matrix, mesh, solverParams, usedF, 3, AE, AI, c);
+}
+
+
+// see .hpp file for prototype
+void ARS443(double t, Field& field, const Matrix& matrix,
+            const Mesh& mesh, const SolverParams& solverParams, UsedF usedF)
+{
+    static const double AE[25] = {0,        0,          0,          0,      0,
+                                  1.0/2,    0,          0,          0,      0,
+                                  11.0/18,  1.0/18,     0,          0,      0,
+                                  5.0/6,    -5.0/6,     1.0/2,      0,      0,
+                                  1.0/4,    7.0/4,      3.0/4,      -7.0/4, 0};
+    static const double AI[25] = {0,        0,          0,          0,      0,
+                                  0,        1.0/2,      0,          0,      0,
+                                  0,        1.0/6,      1.0/2,      0,      0,
+                                  0,        -1.0/2,     1.0/2,      1.0/2,  0,
+                                  0,        3.0/2,      -3.0/2,     1.0/2,  1.0/2};
+    static const double c[5] = {0, 1.0/2, 2.0/3, 1.0/2, 1};
+
+    IMEXRK(t, field, matrix, mesh, solverParams, usedF, 5, AE, AI, c);
 }
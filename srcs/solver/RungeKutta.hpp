@@ -1,4 +1,5 @@
 #include <functional>
+#include <string>
 #include "field.hpp"
 #include "../matrices/matrix.hpp"
 #include "../params/Params.hpp"
@@ -9,68 +10,172 @@ typedef std::function<void (double, Field &, const Matrix &,
       const Mesh &, const SolverParams &)> UsedF;
 
 typedef std::function<void(double, Field&, const Matrix&,
-         const Mesh&, const SolverParams&, Field&, UsedF)> IntegScheme;
+         const Mesh&, const SolverParams&, UsedF)> IntegScheme;
+
+/*
+ * The stages are evaluated in place: field.u is swapped (std::vector::swap, no
+ * copy) with a register holding the solution at the beginning of the step, so
+ * that usedF always works on field. Each scheme only uses the registers it
+ * needs (field.registers, allocated with Field::allocateRegisters).
+ */
+
+/**
+ * \brief Get the time integration scheme of a given name.
+ * \param timeIntType Name of the scheme (RK1, RK2, RK3 or RK4).
+ * \param integScheme The corresponding scheme.
+ * \param numRegisters The number of registers needed by the scheme.
+ * \return true if the scheme exists, false otherwise.
+ */
+bool getIntegScheme(const std::string& timeIntType, IntegScheme& integScheme,
+                    unsigned short& numRegisters);
 
 
 /**
  * \brief Compute the numerical time integration using the method of Runge-Kutta order 1
-    i.e. explicit Euler
+    i.e. explicit Euler (no register).
  * \param t Current time.
  * \param field Field that contains all the main variables.
- * \param partialField Field that contains all the main variables (private)
  * \param matrix Structure that contains the matrices of the DG method.
  * \param mesh Mesh representing the domain.
  * \param solverParams Parameters of the solver.
- * \param temp temporary Field needed to compute the different k's
  * \param usedF pointer to the function Fweak or Fstrong
  */
 void RK1(double t, Field& field, const Matrix& matrix,
-         const Mesh& mesh, const SolverParams& solverParams, Field& temp, UsedF usedF);
+         const Mesh& mesh, const SolverParams& solverParams, UsedF usedF);
 
 
 /**
  * \brief Compute the numerical time integration using the method of Runge-Kutta order 2
-    i.e. explicit Euler
+    i.e. explicit midpoint (one register: the solution at the beginning of the step).
  * \param t Current time.
  * \param field Field that contains all the main variables.
- * \param partialField Field that contains all the main variables (private)
  * \param matrix Structure that contains the matrices of the DG method.
  * \param mesh Mesh representing the domain.
  * \param solverParams Parameters of the solver.
- * \param temp temporary Field needed to compute the different k's
  * \param usedF pointer to the function Fweak or Fstrong
  */
 void RK2(double t, Field& field, const Matrix& matrix,
-         const Mesh& mesh, const SolverParams& solverParams, Field& temp, UsedF usedF);
+         const Mesh& mesh, const SolverParams& solverParams, UsedF usedF);
 
 
 /**
  * \brief Compute the numerical time integration using the method of Runge-Kutta order 3
-    i.e. explicit Euler
+    i.e. Kutta's third order method (two registers: the solution at the beginning of
+    the step and k1, then the sum of the k's).
  * \param t Current time.
  * \param field Field that contains all the main variables.
- * \param partialField Field that contains all the main variables (private)
  * \param matrix Structure that contains the matrices of the DG method.
  * \param mesh Mesh representing the domain.
  * \param solverParams Parameters of the solver.
- * \param temp temporary Field needed to compute the different k's
  * \param usedF pointer to the function Fweak or Fstrong
  */
 void RK3(double t, Field& field, const Matrix& matrix,
-         const Mesh& mesh, const SolverParams& solverParams, Field& temp, UsedF usedF);
+         const Mesh& mesh, const SolverParams& solverParams, UsedF usedF);
 
 
 /**
  * \brief Compute the numerical time integration using the method of Runge-Kutta order 4
-    i.e. explicit Euler
+    i.e. the classical method (two registers: the solution at the beginning of the
+    step and the sum of the k's).
  * \param t Current time.
  * \param field Field that contains all the main variables.
- * \param partialField Field that contains all the main variables (private)
  * \param matrix Structure that contains the matrices of the DG method.
  * \param mesh Mesh representing the domain.
  * \param solverParams Parameters of the solver.
- * \param temp temporary Field needed to compute the different k's
  * \param usedF pointer to the function Fweak or Fstrong
  */
 void RK4(double t, Field& field, const Matrix& matrix,
-         const Mesh& mesh, const SolverParams& solverParams, Field& temp, UsedF usedF);
+         const Mesh& mesh, const SolverParams& solverParams, UsedF usedF);
+
+
+/**
+ * \brief Compute the numerical time integration using the 2N-storage low-storage
+    Runge-Kutta method of order 4 with 5 stages of Carpenter and Kennedy (one
+    register: the stage increment).
+ * \param t Current time.
+ * \param field Field that contains all the main variables.
+ * \param matrix Structure that contains the matrices of the DG method.
+ * \param mesh Mesh representing the domain.
+ * \param solverParams Parameters of the solver.
+ * \param usedF pointer to the function Fweak or Fstrong
+ */
+void LSRK54(double t, Field& field, const Matrix& matrix,
+            const Mesh& mesh, const SolverParams& solverParams, UsedF usedF);
+
+
+/**
+ * \brief Compute the numerical time integration using the strong stability
+    preserving Runge-Kutta method of order 3 with 3 stages of Shu and Osher (one
+    register: the solution at the beginning of the step).
+ * \param t Current time.
+ * \param field Field that contains all the main variables.
+ * \param matrix Structure that contains the matrices of the DG method.
+ * \param mesh Mesh representing the domain.
+ * \param solverParams Parameters of the solver.
+ * \param usedF pointer to the function Fweak or Fstrong
+ */
+void SSPRK3(double t, Field& field, const Matrix& matrix,
+            const Mesh& mesh, const SolverParams& solverParams, UsedF usedF);
+
+
+/**
+ * \brief Compute the numerical time integration using the strong stability
+    preserving Runge-Kutta method of order 4 with 5 stages of Spiteri and Ruuth
+    (SSP coefficient 1.508, two registers: the solution at the beginning of the
+    step and a combination of the later stages).
+ * \param t Current time.
+ * \param field Field that contains all the main variables.
+ * \param matrix Structure that contains the matrices of the DG method.
+ * \param mesh Mesh representing the domain.
+ * \param solverParams Parameters of the solver.
+ * \param usedF pointer to the function Fweak or Fstrong
+ */
+void SSPRK54(double t, Field& field, const Matrix& matrix,
+             const Mesh& mesh, const SolverParams& solverParams, UsedF usedF);
+
+
+/**
+ * \brief Compute the numerical time integration using the low-storage strong
+    stability preserving Runge-Kutta method of order 4 with 10 stages of Ketcheson
+    (SSP coefficient 6, i.e. 0.6 per stage, one register).
+ * \param t Current time.
+ * \param field Field that contains all the main variables.
+ * \param matrix Structure that contains the matrices of the DG method.
+ * \param mesh Mesh representing the domain.
+ * \param solverParams Parameters of the solver.
+ * \param usedF pointer to the function Fweak or Fstrong
+ */
+void SSPRK104(double t, Field& field, const Matrix& matrix,
+              const Mesh& mesh, const SolverParams& solverParams, UsedF usedF);
+
+
+/**
+ * \brief Compute the numerical time integration using the IMEX Runge-Kutta method
+    ARS(2,2,2) of Ascher, Ruuth and Spiteri (order 2, L-stable and stiffly
+    accurate): the source term is treated implicitly (SolverParams::implicitSource),
+    the rest explicitly (two registers).
+ * \param t Current time.
+ * \param field Field that contains all the main variables.
+ * \param matrix Structure that contains the matrices of the DG method.
+ * \param mesh Mesh representing the domain.
+ * \param solverParams Parameters of the solver.
+ * \param usedF pointer to the function Fweak or Fstrong
+ */
+void ARS222(double t, Field& field, const Matrix& matrix,
+            const Mesh& mesh, const SolverParams& solverParams, UsedF usedF);
+
+
+/**
+ * \brief Compute the numerical time integration using the IMEX Runge-Kutta method
+    ARS(4,4,3) of Ascher, Ruuth and Spiteri (order 3, L-stable and stiffly
+    accurate): the source term is treated implicitly (SolverParams::implicitSource),
+    the rest explicitly (four registers).
+ * \param t Current time.
+ * \param field Field that contains all the main variables.
+ * \param matrix Structure that contains the matrices of the DG method.
+ * \param mesh Mesh representing the domain.
+ * \param solverParams Parameters of the solver.
+ * \param usedF pointer to the function Fweak or Fstrong
+ */
+void ARS443(double t, Field& field, const Matrix& matrix,
+            const Mesh& mesh, const SolverParams& solverParams, UsedF usedF);
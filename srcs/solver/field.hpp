@@ -3,6 +3,38 @@
 
 #include <vector>
 #include <Eigen/Dense>
+#if defined(_OPENMP)
+    #include <omp.h>
+#endif
+
+/**
+ * \struct PartialField
+ * \brief Structure that contains temporary unknowns while computing th fluxes.
+ */
+struct PartialField
+{
+    std::vector<Eigen::VectorXd> partialIu;         /**< Partial RHS */
+    std::vector<Eigen::VectorXd> g;                 /**< Normal fluxes at the nodes of the current edge (one vector per unknown) */
+
+    std::vector<double> uAtBC;                  /**< Boundary fields (useful for the computation of the flux at BC) */
+
+    /**
+     * \brief Constructor
+     * \param numUnknown The number of unknowns of the problem.
+     * \param nSF The maximum number of shape functions of an element.
+     */
+    PartialField(unsigned short numUnknown, unsigned int nSF)
+    {
+        partialIu.resize(numUnknown);
+        uAtBC.resize(numUnknown);
+        g.resize(numUnknown);
+        for(unsigned short i = 0 ; i < numUnknown ; ++i)
+        {
+            partialIu[i].resize(nSF);
+            g[i].resize(nSF);
+        }
+    }
+};
 
 
 /**
@@ -24,18 +56,28 @@ struct Field
 
     std::vector<Eigen::VectorXd> Iu; /**< RHS fields */
 
-    std::vector<Eigen::VectorXd> k1; /**< Temporary integration variables (useful for RK schemes) */
-    std::vector<Eigen::VectorXd> k2; /**< Temporary integration variables (useful for RK schemes) */
-    std::vector<Eigen::VectorXd> k3; /**< Temporary integration variables (useful for RK schemes) */
-    std::vector<Eigen::VectorXd> k4; /**< Temporary integration variables (useful for RK schemes) */
+    std::vector<double> faceFlux; /**< Numerical fluxes normal to the edges at
+                                       each face point (numUnknown values per
+                                       point) */
+
+    std::vector<PartialField> partialFields; /**< Workspaces for the computation
+                                                  of the fluxes (one per thread) */
+
+    std::vector<std::vector<Eigen::VectorXd>> registers; /**< Extra solution
+                                                              registers of the time
+                                                              integration scheme
+                                                              (see RungeKutta.hpp) */
 
     /**
      * \brief Constructor
      * \param numNodes The number of nodes in the mesh.
      * \param numUnknown The number of unknowns of the problem.
      * \param dim The dimension of the mesh.
+     * \param numFacePoints The number of face points (counted once per edge).
+     * \param maxNSF The maximum number of shape functions of an element.
      */
-    Field(unsigned int numNodes, unsigned short numUnknown, unsigned short dim)
+    Field(unsigned int numNodes, unsigned short numUnknown, unsigned short dim,
+          unsigned int numFacePoints, unsigned int maxNSF)
     {
         // resize each field
         flux.resize(dim);
@@ -61,40 +103,27 @@ struct Field
             }
         }
 
-        k1.resize(numNodes);
-        k2.resize(numNodes);
-        k3.resize(numNodes);
-        k4.resize(numNodes);
-    }
-};
+        faceFlux.resize(numFacePoints*numUnknown);
 
-/**
- * \struct PartialField
- * \brief Structure that contains temporary unknowns while computing th fluxes.
- */
-struct PartialField
-{
-    std::vector<Eigen::VectorXd> partialIu;         /**< Partial RHS */
-    std::vector<std::vector<Eigen::VectorXd>> g;    /**< Partial fields (useful for the computation of the flux at the nodes) */
-
-    std::vector<std::vector<double>> FluxAtBC;  /**< Boundary fluxes */
-    std::vector<double> uAtBC;                  /**< Boundary fields (useful for the computation of the flux at BC) */
+        // the workspaces are allocated once and reused at each time step
+        unsigned int numThreads = 1;
+        #if defined(_OPENMP)
+            numThreads = omp_get_max_threads();
+        #endif
+        partialFields.assign(numThreads, PartialField(numUnknown, maxNSF));
+    }
 
     /**
-     * \brief Constructor
-     * \param numUnknown The number of unknowns of the problem.
-     * \param dim The dimension of the mesh.
+     * \brief Allocate the registers needed by the time integration scheme.
+     * \param numRegisters The number of registers (each of the size of u).
      */
-    PartialField(unsigned short numUnknown, unsigned short dim)
+    void allocateRegisters(unsigned short numRegisters)
     {
-        partialIu.resize(numUnknown);
-        uAtBC.resize(numUnknown);
-        g.resize(dim);
-        FluxAtBC.resize(dim);
-        for(unsigned short i = 0 ; i < dim ; ++i)
+        registers.assign(numRegisters, std::vector<Eigen::VectorXd>(u.size()));
+        for(unsigned short r = 0 ; r < numRegisters ; ++r)
         {
-            FluxAtBC[i].resize(numUnknown);
-            g[i].resize(numUnknown);
+            for(unsigned short i = 0 ; i < u.size() ; ++i)
+                registers[r][i].resize(u[i].size());
         }
     }
 };
@@ -0,0 +1,37 @@
+#ifndef fieldLayout_hpp_included
+#define fieldLayout_hpp_included
+
+#include "field.hpp"
+
+// The kernels reading the nodal unknowns and physical fluxes of both sides of
+// the edges (the numerical fluxes) access them through a layout, such that other
+// storages can be compared with the one of Field (see layoutBenchmark.cpp).
+
+
+/**
+ * \struct SplitLayout
+ * \brief Access to the nodal unknowns and physical fluxes in the storage of
+ * Field (one vector per unknown and per flux component).
+ */
+struct SplitLayout
+{
+    const Field& field; /**< Field containing the values */
+
+    /**
+     * \brief Unknown unk at a node.
+     */
+    double u(unsigned short unk, unsigned int node) const
+    {
+        return field.u[unk][node];
+    }
+
+    /**
+     * \brief Component dim of the physical flux of the unknown unk at a node.
+     */
+    double flux(unsigned short dim, unsigned short unk, unsigned int node) const
+    {
+        return field.flux[dim][unk][node];
+    }
+};
+
+#endif // fieldLayout_hpp_included
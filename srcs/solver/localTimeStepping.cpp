@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <cmath>
+#include "localTimeStepping.hpp"
+#include "../flux/buildFlux.hpp"
+#include "../matrices/buildS.hpp"
+
+
+// see .hpp file for description
+void computeElementIncrement(const Mesh& mesh, const Matrix& matrix, Field& field,
+                             PartialField& partialField, std::size_t elm,
+                             const SolverParams& solverParams)
+{
+    const SolverMesh& solverMesh = mesh.solverMesh;
+    unsigned int nSF = solverMesh.typeNSF[solverMesh.elmType[elm]];
+    unsigned int offsetInU = solverMesh.elmOffsetInU[elm];
+
+    // surface term
+    liftFluxes(mesh, field, partialField, elm, 1);
+
+    Eigen::Map<const Eigen::MatrixXd>
+        invM(&matrix.invM.values[matrix.invM.elmBegin[elm]], nSF, nSF);
+    double scale = matrix.invM.elmScale[elm];
+
+    for(unsigned short unk = 0 ; unk < field.DeltaU.size() ; ++unk)
+    {
+        // volume term
+        applyElementS(solverMesh, matrix.S, elm,
+                      field.flux[0][unk].data() + offsetInU,
+                      field.flux[1][unk].data() + offsetInU,
+                      partialField.partialIu[unk].data(), false);
+
+        // increment
+        field.DeltaU[unk].segment(offsetInU, nSF).noalias()
+            = scale*(invM*partialField.partialIu[unk].head(nSF));
+
+        if(solverParams.IsSourceTerms)
+            field.DeltaU[unk].segment(offsetInU, nSF)
+                += field.s[unk].segment(offsetInU, nSF);
+    }
+}
+
+
+/**
+ * \brief Sort items by decreasing level (counting sort).
+ * \param level Level of each item.
+ * \param nLevels Number of levels.
+ * \param sorted The items sorted by decreasing level.
+ * \param levelEnd The items of level l or finer are sorted[0, levelEnd[l]).
+ */
+static void sortByLevel(const std::vector<unsigned short>& level,
+                        unsigned short nLevels, std::vector<unsigned int>& sorted,
+                        std::vector<unsigned int>& levelEnd)
+{
+    levelEnd.assign(nLevels + 1, 0);
+    for(unsigned short l : level)
+        levelEnd[l]++;
+
+    // cumulated counts, from the finest level
+    unsigned int count = 0;
+    for(int l = nLevels - 1 ; l >= 0 ; --l)
+    {
+        count += levelEnd[l];
+        levelEnd[l] = count;
+    }
+
+    // the items of level l are sorted[levelEnd[l + 1], levelEnd[l])
+    std::vector<unsigned int> next(levelEnd.begin() + 1, levelEnd.end());
+    sorted.resize(level.size());
+    for(unsigned int i = 0 ; i < level.size() ; ++i)
+        sorted[next[level[i]]++] = i;
+}
+
+
+// see .hpp file for description
+double buildLocalTimeStepping(const Mesh& mesh,
+                              const std::vector<double>& elmTimeStep,
+                              double dtMax, unsigned short maxLevels,
+                              unsigned short numUnknown, LocalTimeStepping& lts)
+{
+    const SolverMesh& solverMesh = mesh.solverMesh;
+    std::size_t nElements = solverMesh.elmType.size();
+
+    // coarse time step: the finest level must be stable for the smallest element
+    // and the coarsest level should not be empty
+    double dtMinElm = *std::min_element(elmTimeStep.begin(), elmTimeStep.end());
+    double dtMaxElm = *std::max_element(elmTimeStep.begin(), elmTimeStep.end());
+    double dt = std::min({dtMax, dtMaxElm,
+                          std::ldexp(dtMinElm, maxLevels - 1)});
+
+    lts.nLevels = 1;
+    lts.elmLevel.resize(nElements);
+    for(std::size_t elm = 0 ; elm < nElements ; ++elm)
+    {
+        unsigned short level = 0;
+        while(level < maxLevels - 1 && std::ldexp(dt, -level) > elmTimeStep[elm])
+            level++;
+
+        lts.elmLevel[elm] = level;
+        lts.nLevels = std::max<unsigned short>(lts.nLevels, level + 1);
+    }
+    sortByLevel(lts.elmLevel, lts.nLevels, lts.elements, lts.levelElmEnd);
+
+    // element of each node, to find the element in front of each face point
+    std::vector<unsigned int> nodeElm(mesh.nodeData.numNodes);
+    for(std::size_t elm = 0 ; elm < nElements ; ++elm)
+    {
+        unsigned int offsetInU = solverMesh.elmOffsetInU[elm];
+        unsigned int nSF = solverMesh.typeNSF[solverMesh.elmType[elm]];
+        std::fill(nodeElm.begin() + offsetInU, nodeElm.begin() + offsetInU + nSF,
+                  elm);
+    }
+
+    std::size_t nPoints = solverMesh.pointFace.size();
+    lts.pointLevel.resize(nPoints);
+    lts.pointLowLevel.resize(nPoints);
+    lts.interfacePoints.clear();
+    for(std::size_t p = 0 ; p < nPoints ; ++p)
+    {
+        unsigned short levelIn
+            = lts.elmLevel[nodeElm[solverMesh.pointIndex[2*p]]];
+        unsigned short levelOut
+            = lts.elmLevel[nodeElm[solverMesh.pointIndex[2*p + 1]]];
+
+        lts.pointLevel[p] = std::max(levelIn, levelOut);
+        lts.pointLowLevel[p] = std::min(levelIn, levelOut);
+        if(levelIn != levelOut)
+            lts.interfacePoints.push_back(p);
+    }
+    sortByLevel(lts.pointLevel, lts.nLevels, lts.points, lts.levelPointEnd);
+
+    lts.fluxSum.resize(numUnknown*lts.interfacePoints.size());
+
+    return dt;
+}
+
+
+// see .hpp file for description
+void localTimeStep(double t, double dt, Field& field, const Matrix& matrix,
+                   const Mesh& mesh, const SolverParams& solverParams,
+                   LocalTimeStepping& lts)
+{
+    unsigned short N = solverParams.nUnknowns;
+    unsigned short finest = lts.nLevels - 1;
+    unsigned int nSubSteps = 1 << finest;
+    double h = std::ldexp(dt, -finest);
+
+    for(unsigned int k = 0 ; k < nSubSteps ; ++k)
+    {
+        // the levels l >= begin start a step at k, the levels l >= end finish
+        // their step at k + 1 (a step of level l lasts 2^(finest - l) substeps)
+        unsigned short begin = finest, end = finest;
+        while(begin > 0 && k % (1 << (finest - begin + 1)) == 0)
+            begin--;
+        while(end > 0 && (k + 1) % (1 << (finest - end + 1)) == 0)
+            end--;
+
+        // physical fluxes and source terms of the elements starting a step, then
+        // numerical fluxes at their face points (the other elements have not
+        // moved since the beginning of their step)
+        solverParams.localFluxes(mesh, field, t + k*h, solverParams, lts.elements,
+                                 lts.levelElmEnd[begin], lts.points,
+                                 lts.levelPointEnd[begin]);
+
+        if(solverParams.IsSourceTerms)
+        {
+            solverParams.localSourceTerm(mesh, field, solverParams, lts.elements,
+                                         lts.levelElmEnd[begin]);
+        }
+
+        // time integral of the numerical fluxes at the interfaces, over the step
+        // of their coarse side
+        #if defined(_OPENMP)
+            #pragma omp parallel for default(none) \
+                shared(field, lts, N, k, finest, begin, dt)
+        #endif
+        for(std::size_t i = 0 ; i < lts.interfacePoints.size() ; ++i)
+        {
+            unsigned int p = lts.interfacePoints[i];
+            if(lts.pointLevel[p] < begin)
+                continue;
+
+            double* sum = &lts.fluxSum[N*i];
+            if(k % (1 << (finest - lts.pointLowLevel[p])) == 0)
+                std::fill(sum, sum + N, 0.0);
+
+            double hPoint = std::ldexp(dt, -lts.pointLevel[p]);
+            for(unsigned short unk = 0 ; unk < N ; ++unk)
+                sum[unk] += hPoint*field.faceFlux[N*p + unk];
+        }
+
+        // forward Euler step of the elements finishing their step, from the
+        // finest level (which uses the last numerical fluxes at the interfaces)
+        // to the coarsest (which uses their time average)
+        for(int level = finest ; level >= end ; --level)
+        {
+            double hLevel = std::ldexp(dt, -level);
+
+            #if defined(_OPENMP)
+                #pragma omp parallel default(none) \
+                    shared(field, matrix, mesh, solverParams, lts, N, level, \
+                           hLevel)
+            #endif
+            {
+                #if defined(_OPENMP)
+                    #pragma omp for
+                #endif
+                for(std::size_t i = 0 ; i < lts.interfacePoints.size() ; ++i)
+                {
+                    unsigned int p = lts.interfacePoints[i];
+                    if(lts.pointLowLevel[p] != level)
+                        continue;
+
+                    for(unsigned short unk = 0 ; unk < N ; ++unk)
+                        field.faceFlux[N*p + unk] = lts.fluxSum[N*i + unk]/hLevel;
+                }
+
+                PartialField& partialField = getPartialField(field);
+                const SolverMesh& solverMesh = mesh.solverMesh;
+
+                #if defined(_OPENMP)
+                    #pragma omp for
+                #endif
+                for(unsigned int e = lts.levelElmEnd[level + 1] ;
+                    e < lts.levelElmEnd[level] ; ++e)
+                {
+                    unsigned int elm = lts.elements[e];
+                    unsigned int nSF = solverMesh.typeNSF[solverMesh.elmType[elm]];
+                    unsigned int offsetInU = solverMesh.elmOffsetInU[elm];
+
+                    computeElementIncrement(mesh, matrix, field, partialField, elm,
+                                            solverParams);
+
+                    for(unsigned short unk = 0 ; unk < N ; ++unk)
+                        field.u[unk].segment(offsetInU, nSF)
+                            += field.DeltaU[unk].segment(offsetInU, nSF)*hLevel;
+                }
+            }
+        }
+    }
+}
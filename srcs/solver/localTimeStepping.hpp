@@ -0,0 +1,104 @@
+#ifndef localTimeStepping_hpp_included
+#define localTimeStepping_hpp_included
+
+#include <vector>
+#include "field.hpp"
+#include "../matrices/matrix.hpp"
+#include "../params/Params.hpp"
+#include "../mesh/Mesh.hpp"
+
+
+/**
+ * \struct LocalTimeStepping
+ * \brief Levels of the local (multirate) time stepping: the elements of level l
+ * are advanced with forward Euler steps of dt/2^l, dt being the coarse time step.
+ * A face point has the finest level of its two sides. At the interface between
+ * two levels, the coarse side uses the time average of the numerical fluxes
+ * computed during the steps of the fine side, so that the scheme is conservative
+ * (Osher and Sanders). The elements and face points are sorted from the finest
+ * level to the coarsest, so that the ones of level l or finer are always at the
+ * beginning of the lists.
+ */
+struct LocalTimeStepping
+{
+    unsigned short nLevels;                 /**< Number of levels */
+
+    std::vector<unsigned short> elmLevel;   /**< Level of each element */
+    std::vector<unsigned int> elements;     /**< Elements sorted by decreasing
+                                                level */
+    std::vector<unsigned int> levelElmEnd;  /**< The elements of level l or finer
+                                                are elements[0, levelElmEnd[l])
+                                                (size: nLevels + 1) */
+
+    std::vector<unsigned short> pointLevel; /**< Finest level of the two sides of
+                                                each face point */
+    std::vector<unsigned short> pointLowLevel;  /**< Coarsest level of the two
+                                                    sides of each face point */
+    std::vector<unsigned int> points;       /**< Face points sorted by decreasing
+                                                level */
+    std::vector<unsigned int> levelPointEnd;/**< The face points of level l or
+                                                finer are points[0,
+                                                levelPointEnd[l])
+                                                (size: nLevels + 1) */
+
+    std::vector<unsigned int> interfacePoints;  /**< Face points between two
+                                                    levels */
+    std::vector<double> fluxSum;            /**< Time integral of the numerical
+                                                flux at each interface point
+                                                over the current step of its
+                                                coarse side (numUnknown values
+                                                per interface point) */
+};
+
+
+/**
+ * \brief Compute the increment of the unknowns of one element, for the strong
+ * form, once the physical and numerical fluxes are computed: the surface term,
+ * the volume term, the inverse mass matrix and the source term are applied to the
+ * element while its data is in cache.
+ * \param mesh Mesh representing the domain.
+ * \param matrix Structure that contains the matrices of the DG method.
+ * \param field Structure that contains all the main variables.
+ * \param partialField Workspace of the calling thread.
+ * \param elm Index of the element.
+ * \param solverParams Parameters of the solver.
+ */
+void computeElementIncrement(const Mesh& mesh, const Matrix& matrix, Field& field,
+                             PartialField& partialField, std::size_t elm,
+                             const SolverParams& solverParams);
+
+
+/**
+ * \brief Assign the elements to the levels of the local time stepping and choose
+ * the coarse time step: the level of an element is the smallest l such that
+ * dt/2^l is below its stable time step.
+ * \param mesh Mesh representing the domain.
+ * \param elmTimeStep The stable time step of each element.
+ * \param dtMax Upper bound of the coarse time step.
+ * \param maxLevels Maximum number of levels.
+ * \param numUnknown The number of unknowns of the problem.
+ * \param lts The levels of the local time stepping.
+ * \return The coarse time step.
+ */
+double buildLocalTimeStepping(const Mesh& mesh,
+                              const std::vector<double>& elmTimeStep,
+                              double dtMax, unsigned short maxLevels,
+                              unsigned short numUnknown, LocalTimeStepping& lts);
+
+
+/**
+ * \brief Advance the field of one coarse time step with the local time stepping,
+ * i.e. 2^(nLevels - 1) steps of the finest level.
+ * \param t Current time.
+ * \param dt Coarse time step.
+ * \param field Field that contains all the main variables.
+ * \param matrix Structure that contains the matrices of the DG method.
+ * \param mesh Mesh representing the domain.
+ * \param solverParams Parameters of the solver.
+ * \param lts The levels of the local time stepping.
+ */
+void localTimeStep(double t, double dt, Field& field, const Matrix& matrix,
+                   const Mesh& mesh, const SolverParams& solverParams,
+                   LocalTimeStepping& lts);
+
+#endif // localTimeStepping_hpp_included
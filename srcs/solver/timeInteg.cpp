@@ -1,13 +1,20 @@
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
 #include <cassert>
 #include <gmsh.h>
+#include "../matrices/buildM.hpp"
 #include "../matrices/buildMatrix.hpp"
+#include "../matrices/buildS.hpp"
 #include "../matrices/matrix.hpp"
 #include "../flux/buildFlux.hpp"
 #include "../write/write.hpp"
+#include "../write/asyncWrite.hpp"
+#include "../write/snapshot.hpp"
 #include "timeInteg.hpp"
 #include "field.hpp"
 #include "RungeKutta.hpp"
+#include "localTimeStepping.hpp"
 
 
 /**
@@ -24,9 +31,7 @@ static void Fweak(double t, Field& field,
                   const SolverParams& solverParams)
 {
     // compute the nodal physical fluxes
-    PartialField partialField(solverParams.nUnknowns, mesh.dim);
-
-    solverParams.flux(field, partialField, solverParams, false);
+    solverParams.flux(field, solverParams);
 
     if(solverParams.IsSourceTerms)
         solverParams.sourceTerm(field, solverParams);
@@ -34,16 +39,16 @@ static void Fweak(double t, Field& field,
     // compute the right-hand side of the master equation (phi or psi)
     buildFlux(mesh, field, 1, t, solverParams);
 
+    // add the volume term
+    applyS(mesh, matrix.S, field, true);
+
     // compute the increment
-    for(unsigned short unk = 0 ; unk < field.DeltaU.size() ; ++unk)
-    {
-        field.DeltaU[unk]
-            = matrix.invM*(field.Iu[unk] + matrix.Sx*field.flux[0][unk]
-                            + matrix.Sy*field.flux[1][unk]);
+    applyBlockDiagonal(mesh, matrix.invM, field.Iu, field.DeltaU);
 
-        if(solverParams.IsSourceTerms)
+    if(solverParams.IsSourceTerms)
+    {
+        for(unsigned short unk = 0 ; unk < field.DeltaU.size() ; ++unk)
             field.DeltaU[unk]+=field.s[unk];
-
     }
 }
 
@@ -60,10 +65,8 @@ static void Fweak(double t, Field& field,
 static void Fstrong(double t, Field& field, const Matrix& matrix, const Mesh& mesh,
                     const SolverParams& solverParams)
 {
-    PartialField partialField(solverParams.nUnknowns, mesh.dim);
-
     // compute the nodal physical fluxes
-    solverParams.flux(field, partialField, solverParams, false);
+    solverParams.flux(field, solverParams);
 
     if(solverParams.IsSourceTerms)
         solverParams.sourceTerm(field, solverParams);
@@ -71,19 +74,96 @@ static void Fstrong(double t, Field& field, const Matrix& matrix, const Mesh& me
     // compute the right-hand side of the master equation (phi or psi)
     buildFlux(mesh, field, -1, t, solverParams);
 
+    // add the volume term
+    applyS(mesh, matrix.S, field, false);
+
     // compute the increment
-    for(unsigned short unk = 0 ; unk < field.DeltaU.size() ; ++unk)
-    {
-        field.DeltaU[unk]
-            = matrix.invM*(field.Iu[unk] - matrix.Sx*field.flux[0][unk]
-                            - matrix.Sy*field.flux[1][unk]);
+    applyBlockDiagonal(mesh, matrix.invM, field.Iu, field.DeltaU);
 
-        if(solverParams.IsSourceTerms)
+    if(solverParams.IsSourceTerms)
+    {
+        for(unsigned short unk = 0 ; unk < field.DeltaU.size() ; ++unk)
             field.DeltaU[unk]+=field.s[unk];
     }
 }
 
 
+/**
+ * \brief Compute the increment vector of the unknown fields, for the strong form,
+ * in a single pass over the elements: the surface term, the volume term, the
+ * inverse mass matrix and the source term are applied to each element while its
+ * data is in cache.
+ * \param t Current time.
+ * \param field Structure that contains all the main variables.
+ * \param matrix Structure that contains the matrices of the DG method.
+ * \param mesh Mesh representing the domain.
+ * \param solverParams Parameters of the solver.
+ */
+static void Ffused(double t, Field& field, const Matrix& matrix, const Mesh& mesh,
+                   const SolverParams& solverParams)
+{
+    // compute the nodal physical fluxes (the numerical fluxes also require the
+    // ones of the neighbouring elements)
+    solverParams.flux(field, solverParams);
+
+    if(solverParams.IsSourceTerms)
+        solverParams.sourceTerm(field, solverParams);
+
+    // compute the numerical fluxes at the face points
+    solverParams.numericalFluxes(mesh, field, t, solverParams);
+
+    #if defined(_OPENMP)
+        #pragma omp parallel for default(none) \
+            shared(field, matrix, mesh, solverParams)
+    #endif
+    for(size_t elm = 0 ; elm < mesh.solverMesh.elmType.size() ; ++elm)
+    {
+        computeElementIncrement(mesh, matrix, field, getPartialField(field), elm,
+                                solverParams);
+    }
+}
+
+
+/**
+ * \brief Resolve the boundary conditions of the parameters for each BC of the
+ * mesh, such that they are accessed by index while computing the fluxes.
+ * \param mesh Mesh representing the domain.
+ * \param solverParams Parameters of the solver (meshBoundaryConditions is filled).
+ * \return true if each boundary of the mesh has a boundary condition.
+ */
+static bool buildBoundaryConditions(const Mesh& mesh, SolverParams& solverParams)
+{
+    // physical groups which are not on the boundary need no condition
+    std::vector<bool> usedBC(mesh.bcNames.size(), false);
+    for(int bc : mesh.solverMesh.pointBC)
+    {
+        if(bc != -1)
+            usedBC[bc] = true;
+    }
+
+    solverParams.meshBoundaryConditions.clear();
+    for(unsigned int bc = 0 ; bc < mesh.bcNames.size() ; ++bc)
+    {
+        auto boundaryCondition
+            = solverParams.boundaryConditions.find(mesh.bcNames[bc]);
+
+        if(boundaryCondition != solverParams.boundaryConditions.end())
+            solverParams.meshBoundaryConditions.push_back(boundaryCondition->second);
+        else if(!usedBC[bc])
+            solverParams.meshBoundaryConditions.push_back(ibc());
+        else
+        {
+            std::cerr << "No boundary condition given for the physical group "
+                      << mesh.bcNames[bc] << std::endl;
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
 // see .hpp file for description
 bool timeInteg(const Mesh& mesh, SolverParams& solverParams,
                const std::string& fileName, const std::string& resultsName)
@@ -99,6 +179,13 @@ bool timeInteg(const Mesh& mesh, SolverParams& solverParams,
         = static_cast<unsigned int>(solverParams.simTimeDtWrite/solverParams.timeStep);
 
 
+    /*******************************************************************************
+     *                            BOUNDARY CONDITIONS                              *
+     *******************************************************************************/
+    if(!buildBoundaryConditions(mesh, solverParams))
+        return false;
+
+
     /*******************************************************************************
      *                                  MATRICES                                   *
      *******************************************************************************/
@@ -115,8 +202,10 @@ bool timeInteg(const Mesh& mesh, SolverParams& solverParams,
     if(solverParams.solverType == "weak")
     {
         usedF = Fweak;
-        matrix.Sx = matrix.Sx.transpose();
-        matrix.Sy = matrix.Sy.transpose();
+    }
+    else if(solverParams.solverType == "fused")
+    {
+        usedF = Ffused;
     }
     else
     {
@@ -124,7 +213,19 @@ bool timeInteg(const Mesh& mesh, SolverParams& solverParams,
     }
 
     //Initialization of the field of unknowns
-    Field field(mesh.nodeData.numNodes, solverParams.nUnknowns, mesh.dim);
+    unsigned int maxNSF = *std::max_element(mesh.solverMesh.typeNSF.begin(),
+                                            mesh.solverMesh.typeNSF.end());
+    Field field(mesh.nodeData.numNodes, solverParams.nUnknowns, mesh.dim,
+                mesh.solverMesh.pointFace.size(), maxNSF);
+
+    //Function pointer to the used integration scheme, and its registers
+    IntegScheme integScheme;
+    unsigned short numRegisters;
+    if(!getIntegScheme(solverParams.timeIntType, integScheme, numRegisters))
+        return false;
+
+    field.allocateRegisters(numRegisters);
+
 
     /*******************************************************************************
      *                              INITIAL CONDITION                              *
@@ -135,8 +236,9 @@ bool timeInteg(const Mesh& mesh, SolverParams& solverParams,
     {
         for(unsigned int n = 0 ; n < element.nodeTags.size() ; ++n)
         {
-            solverParams.initCondition.ibcFunc(uIC, element.nodesCoord[n], 0, field, 0, {},
-                solverParams.initCondition.coefficients, solverParams.fluxCoeffs);
+            solverParams.initCondition.ibcFunc(uIC, element.nodesCoord[n].data(), 0,
+                field, 0, nullptr, solverParams.initCondition.coefficients,
+                solverParams.fluxCoeffs);
 
             for(unsigned short unk = 0 ; unk < solverParams.nUnknowns ; ++unk)
                 field.u[unk](element.offsetInU + n) = uIC[unk];
@@ -163,46 +265,80 @@ bool timeInteg(const Mesh& mesh, SolverParams& solverParams,
     /*******************************************************************************
      *                              INITIAL CONDITION                              *
      *******************************************************************************/
-    solverParams.write(uDisplay, elementNumNodes, elementTags, modelName,0, 0, field,
-                         solverParams.fluxCoeffs, solverParams.whatToWrite,
-                         solverParams.viewTags);
+    // with the streaming output, each step is appended to the results file as
+    // soon as it is computed, so that the file of a previous run is removed first
+    bool stream = (solverParams.outputMode == "stream");
+    if(stream)
+        std::remove(resultsName.c_str());
+
+    // with the binary output, the unknowns are appended to the results file in
+    // the snapshot format, after its header
+    bool binary = (solverParams.outputMode == "binary");
+    SnapshotWriter snapshotWriter;
+    if(binary && !openSnapshotFile(snapshotWriter, resultsName, fileName, mesh,
+                                   solverParams))
+    {
+        gmsh::finalize();
+        return false;
+    }
 
+    // writing of the results at one step (by the output thread if any, which
+    // then is the only one to call gmsh until it is stopped)
+    auto writeResults = [&](const std::vector<Eigen::VectorXd>& u,
+                            unsigned int nbreStep, double tWrite)
+    {
+        if(binary)
+        {
+            if(!writeSnapshot(snapshotWriter, u, nbreStep, tWrite))
+                std::cerr << "Could not write in " << resultsName << std::endl;
 
-    /*******************************************************************************
-     *                              TIME INTEGRATION                               *
-     *******************************************************************************/
-    // temporary vectors (only for RK4, but I don't want to define them at each time
-    // iteration)
-    Field temp = field;
+            return;
+        }
 
-    //Function pointer to the used integration scheme
-    IntegScheme integScheme;
+        solverParams.write(uDisplay, elementNumNodes, elementTags, modelName,
+                           nbreStep, tWrite, u, solverParams.fluxCoeffs,
+                           solverParams.whatToWrite, solverParams.viewTags);
+        if(stream)
+            writeStep(solverParams.viewTags, solverParams.whatToWrite, resultsName);
+    };
 
-    if (solverParams.timeIntType == "RK1")
-    {
-        integScheme = RK1;
-    }
-    else if (solverParams.timeIntType == "RK2")
+    bool async = (solverParams.outputBuffers > 0);
+    AsyncWriter asyncWriter;
+    if(async)
     {
-        integScheme = RK2;
-    }
-    else if (solverParams.timeIntType == "RK3")
-    {
-        integScheme = RK3;
-    }
-    else if (solverParams.timeIntType == "RK4")
-    {
-        integScheme = RK4;
+        startAsyncWriter(asyncWriter, solverParams.outputBuffers, field,
+                         [&writeResults](const Snapshot& snapshot)
+                         {
+                             writeResults(snapshot.u, snapshot.nbreStep,
+                                          snapshot.t);
+                         });
+        pushSnapshot(asyncWriter, field, 0, 0);
     }
+    else
+        writeResults(field.u, 0, 0);
 
 
+    /*******************************************************************************
+     *                              TIME INTEGRATION                               *
+     *******************************************************************************/
     // numerical integration
+    bool adaptive = (solverParams.timeStepControl != "fixed");
+    bool local = (solverParams.timeStepControl == "LTS");
+    double dtMax = solverParams.timeStep;
+    std::vector<double> elmTimeStep;
+    LocalTimeStepping lts;
+    unsigned int nWrite = 1;
     unsigned int ratio, currentDecade = 0;
-    for(unsigned int nbrStep = 1 ; nbrStep < nTimeSteps + 1 ;
-        nbrStep++)
+    unsigned int nbrStep = 0;
+    while(adaptive ? t < solverParams.simTime : nbrStep < nTimeSteps)
     {
+        nbrStep++;
+
         // display progress
-        ratio = int(100*double(nbrStep - 1)/double(nTimeSteps));
+        if(adaptive)
+            ratio = int(100*t/solverParams.simTime);
+        else
+            ratio = int(100*double(nbrStep - 1)/double(nTimeSteps));
         if(ratio >= currentDecade)
         {
             std::cout  	<< "\r" << "Integrating: " << ratio << "%"
@@ -210,30 +346,88 @@ bool timeInteg(const Mesh& mesh, SolverParams& solverParams,
             currentDecade = ratio + 1;
         }
 
-        integScheme(t, field, matrix, mesh, solverParams, temp, usedF);
+        bool write;
+        if(adaptive)
+        {
+            // stable time step from the current wave speeds
+            if((nbrStep - 1) % solverParams.timeStepUpdate == 0)
+            {
+                solverParams.elementTimeSteps(mesh, field, solverParams,
+                                              elmTimeStep);
+                if(local)
+                {
+                    solverParams.timeStep
+                        = buildLocalTimeStepping(mesh, elmTimeStep, dtMax,
+                                                 solverParams.maxLevels,
+                                                 solverParams.nUnknowns, lts);
+                }
+                else
+                {
+                    solverParams.timeStep
+                        = std::min(dtMax, *std::min_element(elmTimeStep.begin(),
+                                                            elmTimeStep.end()));
+                }
+            }
+
+            // the time step is shortened to hit the writing times (and the end
+            // of the simulation) exactly
+            double tWrite = nWrite*solverParams.simTimeDtWrite;
+            double tNext = std::min(tWrite, solverParams.simTime);
+            double dt = solverParams.timeStep;
+            bool reachNext = (t + dt >= tNext*(1 - 1e-12));
+            if(reachNext)
+                solverParams.timeStep = tNext - t;
+
+            if(local)
+            {
+                localTimeStep(t, solverParams.timeStep, field, matrix, mesh,
+                              solverParams, lts);
+            }
+            else
+                integScheme(t, field, matrix, mesh, solverParams, usedF);
+
+            t = reachNext ? tNext : t + dt;
+            solverParams.timeStep = dt;
+
+            write = (reachNext && tNext == tWrite);
+            if(write)
+                nWrite++;
+        }
+        else
+        {
+            integScheme(t, field, matrix, mesh, solverParams, usedF);
+
+            // add time step
+            t += solverParams.timeStep;
 
-        temp = field;
+            // store the results every Dt only.
+            write = ((nbrStep % nTimeStepsDtWrite) == 0);
+        }
 
         // check that it does not diverge
         // assert(field.u[0].maxCoeff() <= 1E5);
 
-        // add time step
-        t += solverParams.timeStep;
-
-        // store the results every Dt only.
-        if((nbrStep % nTimeStepsDtWrite) == 0)
+        if(write)
         {
-            solverParams.write(uDisplay, elementNumNodes, elementTags, modelName,
-                         nbrStep, t, field, solverParams.fluxCoeffs,
-                         solverParams.whatToWrite, solverParams.viewTags);
+            if(async)
+                pushSnapshot(asyncWriter, field, nbrStep, t);
+            else
+                writeResults(field.u, nbrStep, t);
         }
     }
 
     std::cout << "\r" << "Integrating: 100% of the time steps done" << std::flush
               << std::endl;
+    if(async)
+        stopAsyncWriter(asyncWriter);
+    if(adaptive)
+        std::cout << "Number of time steps: " << nbrStep << std::endl;
+    if(local)
+        std::cout << "Number of time step levels: " << lts.nLevels << std::endl;
 
     // write the results & finalize
-    writeEnd(solverParams.viewTags, solverParams.whatToWrite, resultsName);
+    if(!stream && !binary)
+        writeEnd(solverParams.viewTags, solverParams.whatToWrite, resultsName);
     gmsh::finalize();
 
     return true;
@@ -3,7 +3,6 @@
 
 #include <string>
 #include <Eigen/Dense>
-#include <Eigen/Sparse>
 #include "../mesh/Mesh.hpp"
 #include "../params/Params.hpp"
 
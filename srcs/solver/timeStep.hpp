@@ -0,0 +1,68 @@
+#ifndef timeStep_hpp_included
+#define timeStep_hpp_included
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "../mesh/Mesh.hpp"
+#include "../params/Params.hpp"
+#include "field.hpp"
+
+
+/**
+ * \brief Compute the largest stable time step of each element for the current
+ * field from the CFL condition dt = CFL*h/lambda, h being the characteristic
+ * length of the element (see SolverMesh::elmLength) and lambda the largest wave
+ * speed at its nodes along the normals of its faces (the one of the LF flux).
+ * \param mesh The mesh (with its solverMesh).
+ * \param field Structure containing all the information about the computed unknowns.
+ * \param solverParams Structure containing the solver's parameters (CFL number).
+ * \param elmTimeStep The stable time step of each element (the largest double if
+ * all the wave speeds of the element are zero).
+ */
+template<class Physics>
+void computeElementTimeSteps(const Mesh& mesh, const Field& field,
+                             const SolverParams& solverParams,
+                             std::vector<double>& elmTimeStep)
+{
+    constexpr unsigned short N = Physics::nUnknowns;
+
+    const SolverMesh& solverMesh = mesh.solverMesh;
+    unsigned short meshDim = mesh.dim;
+    elmTimeStep.resize(solverMesh.elmType.size());
+
+    #pragma omp parallel for default(none) \
+        shared(field, solverMesh, meshDim, solverParams, elmTimeStep)
+    for(size_t elm = 0 ; elm < solverMesh.elmType.size() ; ++elm)
+    {
+        unsigned int offsetInU = solverMesh.elmOffsetInU[elm];
+        unsigned int nSF = solverMesh.typeNSF[solverMesh.elmType[elm]];
+
+        double speed = 0.0;
+        for(unsigned int face = solverMesh.elmFaceBegin[elm] ;
+            face < solverMesh.elmFaceBegin[elm + 1] ; ++face)
+        {
+            // the normals are padded to 2 components in 1D
+            double normal[2] = {0.0, 0.0};
+            for(unsigned short dim = 0 ; dim < meshDim ; ++dim)
+                normal[dim] = solverMesh.faceNormal[meshDim*face + dim];
+
+            for(unsigned int j = 0 ; j < nSF ; ++j)
+            {
+                double u[N];
+                for(unsigned short unk = 0 ; unk < N ; ++unk)
+                    u[unk] = field.u[unk](offsetInU + j);
+
+                speed = std::max(speed, Physics::maxEigenvalue(u, normal,
+                                                    solverParams.fluxCoeffs));
+            }
+        }
+
+        if(speed > 0.0)
+            elmTimeStep[elm] = solverParams.CFL*solverMesh.elmLength[elm]/speed;
+        else
+            elmTimeStep[elm] = std::numeric_limits<double>::max();
+    }
+}
+
+#endif // timeStep_hpp_included
@@ -0,0 +1,73 @@
+#include <fstream>
+#include "mappedFile.hpp"
+
+#if defined(MAPPED_FILE_MMAP)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+
+// see .hpp file for description
+MappedFile::MappedFile(const std::string& fileName)
+{
+#if defined(MAPPED_FILE_MMAP)
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if(fd == -1)
+        return;
+
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) == 0)
+    {
+        size = static_cast<std::size_t>(fileStat.st_size);
+        if(size == 0)
+            isOpen = true;
+        else
+        {
+            void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(mapped != MAP_FAILED)
+            {
+                data = static_cast<const char*>(mapped);
+                isOpen = true;
+            }
+        }
+    }
+    close(fd);
+#else
+    std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+    if(!file.is_open())
+        return;
+
+    size = static_cast<std::size_t>(file.tellg());
+    buffer.resize(size);
+    file.seekg(0);
+    file.read(buffer.data(), size);
+    data = buffer.data();
+    isOpen = static_cast<bool>(file);
+#endif
+}
+
+
+// see .hpp file for description
+MappedFile::~MappedFile()
+{
+#if defined(MAPPED_FILE_MMAP)
+    if(data != nullptr)
+        munmap(const_cast<char*>(data), size);
+#endif
+}
+
+
+// see .hpp file for description
+std::uint64_t hashFile(const MappedFile& file)
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    for(std::size_t i = 0 ; i < file.size ; ++i)
+    {
+        hash ^= static_cast<unsigned char>(file.data[i]);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
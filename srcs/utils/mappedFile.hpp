@@ -0,0 +1,49 @@
+#ifndef mappedFile_hpp_included
+#define mappedFile_hpp_included
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define MAPPED_FILE_MMAP
+#endif
+
+
+/**
+ * \struct MappedFile
+ * \brief Read-only view of a whole file (memory-mapped if possible, read in
+ * memory otherwise).
+ */
+struct MappedFile
+{
+    const char* data = nullptr; /**< Content of the file */
+    std::size_t size = 0;       /**< Size of the file */
+    bool isOpen = false;        /**< Whether the file could be read */
+
+    /**
+     * \brief Constructor
+     * \param fileName The name of the file to map.
+     */
+    explicit MappedFile(const std::string& fileName);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile();
+
+#if !defined(MAPPED_FILE_MMAP)
+    private:
+        std::vector<char> buffer;
+#endif
+};
+
+
+/**
+ * \brief Compute the FNV-1a hash of a file content.
+ * \param file The file.
+ * \return The 64-bit hash.
+ */
+std::uint64_t hashFile(const MappedFile& file);
+
+#endif /* mappedFile_hpp_included */
@@ -0,0 +1,90 @@
+#include "asyncWrite.hpp"
+
+
+/**
+ * \brief Loop of the output thread: write the queued snapshots until the end.
+ * \param writer The output thread and its buffers.
+ */
+static void writeSnapshots(AsyncWriter& writer)
+{
+    while(true)
+    {
+        std::unique_lock<std::mutex> lock(writer.mutex);
+        writer.readyCond.wait(lock, [&writer]{
+            return !writer.readySnapshots.empty() || writer.done;
+        });
+
+        // done and nothing left to write
+        if(writer.readySnapshots.empty())
+            return;
+
+        unsigned int buffer = writer.readySnapshots.front();
+        writer.readySnapshots.pop_front();
+        lock.unlock();
+
+        writer.write(writer.snapshots[buffer]);
+
+        lock.lock();
+        writer.freeSnapshots.push_back(buffer);
+        lock.unlock();
+        writer.freeCond.notify_one();
+    }
+}
+
+
+// see .hpp file for description
+void startAsyncWriter(AsyncWriter& writer, unsigned int nBuffers, const Field& field,
+                      const std::function<void(const Snapshot&)>& write)
+{
+    writer.snapshots.resize(nBuffers);
+    for(unsigned int buffer = 0 ; buffer < nBuffers ; ++buffer)
+    {
+        writer.snapshots[buffer].u = field.u;
+        writer.freeSnapshots.push_back(buffer);
+    }
+
+    writer.write = write;
+    writer.done = false;
+    writer.thread = std::thread(writeSnapshots, std::ref(writer));
+}
+
+
+// see .hpp file for description
+void pushSnapshot(AsyncWriter& writer, const Field& field, unsigned int nbreStep,
+                  double t)
+{
+    std::unique_lock<std::mutex> lock(writer.mutex);
+    writer.freeCond.wait(lock, [&writer]{
+        return !writer.freeSnapshots.empty();
+    });
+
+    unsigned int buffer = writer.freeSnapshots.front();
+    writer.freeSnapshots.pop_front();
+    lock.unlock();
+
+    // the buffers have the size of the fields, so that nothing is allocated
+    Snapshot& snapshot = writer.snapshots[buffer];
+    for(unsigned short unk = 0 ; unk < field.u.size() ; ++unk)
+        snapshot.u[unk] = field.u[unk];
+
+    snapshot.nbreStep = nbreStep;
+    snapshot.t = t;
+
+    lock.lock();
+    writer.readySnapshots.push_back(buffer);
+    lock.unlock();
+    writer.readyCond.notify_one();
+}
+
+
+// see .hpp file for description
+void stopAsyncWriter(AsyncWriter& writer)
+{
+    {
+        std::lock_guard<std::mutex> lock(writer.mutex);
+        writer.done = true;
+    }
+    writer.readyCond.notify_one();
+
+    writer.thread.join();
+}
@@ -0,0 +1,86 @@
+#ifndef asyncWrite_hpp_included
+#define asyncWrite_hpp_included
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <Eigen/Dense>
+#include "../solver/field.hpp"
+
+
+/**
+ * \struct Snapshot
+ * \brief Copy of the solution fields at an output step.
+ */
+struct Snapshot
+{
+    std::vector<Eigen::VectorXd> u; /**< Solution fields (one vector per unknown) */
+    unsigned int nbreStep;          /**< Time step of the snapshot */
+    double t;                       /**< Physical time of the snapshot */
+};
+
+
+/**
+ * \struct AsyncWriter
+ * \brief Output thread of the results: at each output step, the solver copies the
+ * solution fields in a free snapshot buffer and goes on, while the output thread
+ * computes the written quantities and calls gmsh. The snapshots are written in
+ * the order in which they are pushed. When no buffer is free (the output thread
+ * is late), the solver waits until a snapshot is written.
+ */
+struct AsyncWriter
+{
+    std::vector<Snapshot> snapshots;        /**< Pre-allocated snapshot buffers */
+    std::deque<unsigned int> freeSnapshots; /**< Buffers that can be filled */
+    std::deque<unsigned int> readySnapshots;/**< Buffers waiting to be written */
+    bool done = false;                      /**< True once the last snapshot is
+                                                 pushed */
+
+    std::function<void(const Snapshot&)> write; /**< Function writing a snapshot
+                                                     (called by the output
+                                                     thread) */
+
+    std::mutex mutex;                       /**< Protects the queues and done */
+    std::condition_variable freeCond;       /**< Signals a free buffer */
+    std::condition_variable readyCond;      /**< Signals a snapshot to write (or
+                                                 the end) */
+    std::thread thread;                     /**< The output thread */
+};
+
+
+/**
+ * \brief Allocate the snapshot buffers and start the output thread.
+ * \param writer The output thread and its buffers.
+ * \param nBuffers Number of snapshot buffers (2 for double buffering).
+ * \param field Structure that contains all the main variables (for the size of
+ * the buffers).
+ * \param write Function writing a snapshot, called by the output thread (it must
+ * be the only one to call gmsh until stopAsyncWriter returns).
+ */
+void startAsyncWriter(AsyncWriter& writer, unsigned int nBuffers, const Field& field,
+                      const std::function<void(const Snapshot&)>& write);
+
+
+/**
+ * \brief Copy the solution fields in a free snapshot buffer and queue it for the
+ * output thread (waits if all the buffers are still to be written).
+ * \param writer The output thread and its buffers.
+ * \param field Structure that contains all the main variables.
+ * \param nbreStep Current time step.
+ * \param t Current simulation physical time.
+ */
+void pushSnapshot(AsyncWriter& writer, const Field& field, unsigned int nbreStep,
+                  double t);
+
+
+/**
+ * \brief Wait until all the queued snapshots are written and stop the output
+ * thread.
+ * \param writer The output thread and its buffers.
+ */
+void stopAsyncWriter(AsyncWriter& writer);
+
+#endif /* asyncWrite_hpp_included */
@@ -0,0 +1,114 @@
+#include <cstdint>
+#include <iostream>
+#include "snapshot.hpp"
+#include "snapshotFormat.hpp"
+#include "../utils/mappedFile.hpp"
+
+
+/**
+ * \brief Write a value in little-endian.
+ * \param out Output stream.
+ * \param value The value.
+ */
+template<typename T>
+static void writeValue(std::ofstream& out, T value)
+{
+    value = littleEndian(value);
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+
+/**
+ * \brief Write a string (its length, then its characters).
+ * \param out Output stream.
+ * \param value The string.
+ */
+static void writeString(std::ofstream& out, const std::string& value)
+{
+    writeValue(out, static_cast<std::uint32_t>(value.size()));
+    out.write(value.data(), value.size());
+}
+
+
+// see .hpp file for description
+bool openSnapshotFile(SnapshotWriter& writer, const std::string& resultsName,
+                      const std::string& meshFileName, const Mesh& mesh,
+                      const SolverParams& solverParams)
+{
+    MappedFile meshFile(meshFileName);
+    if(!meshFile.isOpen)
+    {
+        std::cerr << "Could not read mesh file " << meshFileName << std::endl;
+        return false;
+    }
+
+    writer.out.open(resultsName, std::ios::binary | std::ios::trunc);
+    if(!writer.out.is_open())
+    {
+        std::cerr << "Could not create results file " << resultsName << std::endl;
+        return false;
+    }
+
+    std::ofstream& out = writer.out;
+    out.write(snapshotMagic, sizeof(snapshotMagic));
+    writeValue(out, snapshotVersion);
+    writeValue(out, static_cast<std::uint32_t>(solverParams.nUnknowns));
+    writeValue(out, hashFile(meshFile));
+    writeValue(out, static_cast<std::uint64_t>(meshFile.size));
+    writeValue(out, static_cast<std::uint64_t>(mesh.nodeData.numNodes));
+
+    writeString(out, solverParams.problemType);
+    for(const std::string& name : solverParams.unknownNames)
+        writeString(out, name);
+
+    writeValue(out, static_cast<std::uint32_t>(solverParams.fluxCoeffs.size()));
+    for(double coeff : solverParams.fluxCoeffs)
+        writeValue(out, coeff);
+
+    writeValue(out, static_cast<std::uint64_t>(mesh.nodeData.elementTags.size()));
+    for(std::size_t tag : mesh.nodeData.elementTags)
+        writeValue(out, static_cast<std::uint64_t>(tag));
+    for(unsigned int numNodes : mesh.nodeData.elementNumNodes)
+        writeValue(out, static_cast<std::uint32_t>(numNodes));
+
+    // the records start at a multiple of 8 bytes, so that their values are
+    // aligned when the file is memory-mapped
+    while(out.tellp() % 8 != 0)
+        out.put(0);
+
+    out.flush();
+
+    return static_cast<bool>(out);
+}
+
+
+// see .hpp file for description
+bool writeSnapshot(SnapshotWriter& writer, const std::vector<Eigen::VectorXd>& u,
+                   unsigned int nbreStep, double t)
+{
+    std::ofstream& out = writer.out;
+    writeValue(out, t);
+    writeValue(out, static_cast<std::uint64_t>(nbreStep));
+
+    for(unsigned short unk = 0 ; unk < u.size() ; ++unk)
+    {
+        if(isLittleEndian())
+        {
+            out.write(reinterpret_cast<const char*>(u[unk].data()),
+                      u[unk].size()*sizeof(double));
+        }
+        else
+        {
+            writer.buffer.resize(u[unk].size());
+            for(unsigned int i = 0 ; i < u[unk].size() ; ++i)
+                writer.buffer[i] = littleEndian(u[unk](i));
+
+            out.write(reinterpret_cast<const char*>(writer.buffer.data()),
+                      writer.buffer.size()*sizeof(double));
+        }
+    }
+
+    out.flush();
+
+    return static_cast<bool>(out);
+}
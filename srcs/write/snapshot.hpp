@@ -0,0 +1,51 @@
+#ifndef snapshot_hpp_included
+#define snapshot_hpp_included
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <Eigen/Dense>
+#include "../mesh/Mesh.hpp"
+#include "../params/Params.hpp"
+
+
+/**
+ * \struct SnapshotWriter
+ * \brief Results file in the binary snapshot format (see snapshotFormat.hpp).
+ */
+struct SnapshotWriter
+{
+    std::ofstream out;                  /**< The results file */
+    std::vector<double> buffer;         /**< Values converted to little-endian
+                                             (big-endian machines only) */
+};
+
+
+/**
+ * \brief Create the results file and write its header.
+ * \param writer The results file.
+ * \param resultsName The name of the results file.
+ * \param meshFileName The name of the .msh file (to store its hash).
+ * \param mesh The mesh (element tags and numbers of nodes).
+ * \param solverParams Parameters of the solver (problem type, names of the
+ * unknowns and coefficients of the physical flux).
+ * \return true if the header was written, false otherwise.
+ */
+bool openSnapshotFile(SnapshotWriter& writer, const std::string& resultsName,
+                      const std::string& meshFileName, const Mesh& mesh,
+                      const SolverParams& solverParams);
+
+
+/**
+ * \brief Append a step to the results file (and flush it, so that the written
+ * steps are kept if the run is interrupted).
+ * \param writer The results file.
+ * \param u Solution fields (one vector per unknown).
+ * \param nbreStep Current time step.
+ * \param t Current simulation physical time.
+ * \return true if the step was written, false otherwise.
+ */
+bool writeSnapshot(SnapshotWriter& writer, const std::vector<Eigen::VectorXd>& u,
+                   unsigned int nbreStep, double t);
+
+#endif /* snapshot_hpp_included */
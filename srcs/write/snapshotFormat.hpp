@@ -0,0 +1,69 @@
+#ifndef snapshotFormat_hpp_included
+#define snapshotFormat_hpp_included
+
+/**
+ * \file snapshotFormat.hpp
+ * \brief Binary snapshot format of the results (outputMode "binary").
+ *
+ * Everything is stored in little-endian. The file starts with a header:
+ * - the magic string snapshotMagic and the format version (uint32),
+ * - the number of unknowns (uint32),
+ * - the hash (see hashFile) and size of the .msh file (uint64),
+ * - the number of nodes (uint64),
+ * - the problem type and the name of each unknown (uint32 length + characters),
+ * - the coefficients of the physical flux (uint32 count + float64 values),
+ * - the number of elements (uint64), the tag of each element (uint64) and its
+ *   number of nodes (uint32), in the order of the unknowns,
+ * - zeros up to a multiple of 8 bytes.
+ * It is followed by one record of fixed size per written step: the time
+ * (float64), the time step (uint64), then the nodal values of each unknown
+ * (float64, unknown after unknown, in the order of offsetInU). A step can thus
+ * be found from its index only, and an incomplete last record (interrupted run)
+ * is ignored by the reader.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+
+// increase it each time the format changes
+static const std::uint32_t snapshotVersion = 1;
+static const char snapshotMagic[8] = {'M', 'P', 'H', 'S', 'N', 'A', 'P', 'S'};
+
+
+/**
+ * \brief Check the byte order of the machine.
+ * \return true if the machine is little-endian.
+ */
+inline bool isLittleEndian()
+{
+    const std::uint32_t one = 1;
+    unsigned char firstByte;
+    std::memcpy(&firstByte, &one, 1);
+
+    return firstByte == 1;
+}
+
+
+/**
+ * \brief Convert a value between the byte order of the machine and little-endian
+ * (the conversion is its own inverse).
+ * \param value The value to convert.
+ * \return The converted value.
+ */
+template<typename T>
+inline T littleEndian(T value)
+{
+    if(isLittleEndian())
+        return value;
+
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    std::reverse(bytes, bytes + sizeof(T));
+    std::memcpy(&value, bytes, sizeof(T));
+
+    return value;
+}
+
+#endif /* snapshotFormat_hpp_included */
@@ -0,0 +1,169 @@
+#include <iostream>
+#include "snapshotReader.hpp"
+#include "snapshotFormat.hpp"
+
+
+/**
+ * \struct HeaderReader
+ * \brief Read little-endian values from the header of a snapshot file. Once
+ * something could not be read, ok is false and nothing more is read.
+ */
+struct HeaderReader
+{
+    const char* current;    /**< Current position in the file */
+    const char* end;        /**< End of the file */
+    bool ok;                /**< Whether everything was read so far */
+
+    template<typename T>
+    T value()
+    {
+        T result = 0;
+        if(!ok || static_cast<std::size_t>(end - current) < sizeof(T))
+        {
+            ok = false;
+            return result;
+        }
+        std::memcpy(&result, current, sizeof(T));
+        current += sizeof(T);
+
+        return littleEndian(result);
+    }
+
+    std::string string()
+    {
+        std::uint32_t size = value<std::uint32_t>();
+        if(!ok || static_cast<std::size_t>(end - current) < size)
+        {
+            ok = false;
+            return std::string();
+        }
+        std::string result(current, size);
+        current += size;
+
+        return result;
+    }
+};
+
+
+// see .hpp file for description
+bool openSnapshotSeries(const std::string& fileName, SnapshotSeries& series)
+{
+    // the values are used in place, in the byte order of the machine
+    if(!isLittleEndian())
+    {
+        std::cerr << "Snapshot files can only be mapped on little-endian machines"
+                  << std::endl;
+        return false;
+    }
+
+    series.file.reset(new MappedFile(fileName));
+    const MappedFile& file = *series.file;
+    if(!file.isOpen || file.size < sizeof(snapshotMagic)
+       || std::memcmp(file.data, snapshotMagic, sizeof(snapshotMagic)) != 0)
+    {
+        std::cerr << fileName << " is not a snapshot file" << std::endl;
+        return false;
+    }
+
+    HeaderReader reader{file.data + sizeof(snapshotMagic), file.data + file.size,
+                        true};
+    std::uint32_t version = reader.value<std::uint32_t>();
+    if(!reader.ok || version != snapshotVersion)
+    {
+        std::cerr << "Unexpected version of the snapshot file " << fileName
+                  << std::endl;
+        return false;
+    }
+
+    std::uint32_t nUnknowns = reader.value<std::uint32_t>();
+    series.meshHash = reader.value<std::uint64_t>();
+    series.meshSize = reader.value<std::uint64_t>();
+    series.numNodes = reader.value<std::uint64_t>();
+
+    series.problemType = reader.string();
+    series.unknownNames.clear();
+    for(std::uint32_t unk = 0 ; unk < nUnknowns && reader.ok ; ++unk)
+        series.unknownNames.push_back(reader.string());
+
+    std::uint32_t nCoeffs = reader.value<std::uint32_t>();
+    series.fluxCoeffs.clear();
+    for(std::uint32_t i = 0 ; i < nCoeffs && reader.ok ; ++i)
+        series.fluxCoeffs.push_back(reader.value<double>());
+
+    // every element takes 12 bytes, which prevents huge allocations on
+    // corrupted files
+    std::uint64_t nElements = reader.value<std::uint64_t>();
+    if(!reader.ok || static_cast<std::uint64_t>(reader.end - reader.current)/12
+                        < nElements)
+    {
+        std::cerr << "Truncated header in snapshot file " << fileName
+                  << std::endl;
+        return false;
+    }
+    series.elementTags.resize(nElements);
+    for(std::size_t& tag : series.elementTags)
+        tag = reader.value<std::uint64_t>();
+    series.elementNumNodes.resize(nElements);
+    for(unsigned int& numNodes : series.elementNumNodes)
+        numNodes = reader.value<std::uint32_t>();
+
+    std::size_t headerSize = reader.current - file.data;
+    headerSize = (headerSize + 7)/8*8;
+    if(!reader.ok || headerSize > file.size)
+    {
+        std::cerr << "Truncated header in snapshot file " << fileName
+                  << std::endl;
+        return false;
+    }
+
+    series.firstStep = file.data + headerSize;
+    series.stepSize = 2*sizeof(double) + nUnknowns*series.numNodes*sizeof(double);
+    series.nSteps = (file.size - headerSize)/series.stepSize;
+
+    return true;
+}
+
+
+// see .hpp file for description
+int findSnapshotUnknown(const SnapshotSeries& series, const std::string& name)
+{
+    for(unsigned int unk = 0 ; unk < series.unknownNames.size() ; ++unk)
+    {
+        if(series.unknownNames[unk] == name)
+            return unk;
+    }
+
+    return -1;
+}
+
+
+// see .hpp file for description
+double snapshotTime(const SnapshotSeries& series, std::size_t step)
+{
+    double t;
+    std::memcpy(&t, series.firstStep + step*series.stepSize, sizeof(double));
+
+    return t;
+}
+
+
+// see .hpp file for description
+unsigned int snapshotTimeStep(const SnapshotSeries& series, std::size_t step)
+{
+    std::uint64_t nbreStep;
+    std::memcpy(&nbreStep, series.firstStep + step*series.stepSize + sizeof(double),
+                sizeof(std::uint64_t));
+
+    return static_cast<unsigned int>(nbreStep);
+}
+
+
+// see .hpp file for description
+const double* snapshotValues(const SnapshotSeries& series, std::size_t step,
+                             unsigned short unk)
+{
+    const char* record = series.firstStep + step*series.stepSize;
+
+    return reinterpret_cast<const double*>(record + 2*sizeof(double))
+           + unk*series.numNodes;
+}
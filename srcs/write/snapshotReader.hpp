@@ -0,0 +1,86 @@
+#ifndef snapshotReader_hpp_included
+#define snapshotReader_hpp_included
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../utils/mappedFile.hpp"
+
+
+/**
+ * \struct SnapshotSeries
+ * \brief Time series of results in the binary snapshot format (see
+ * snapshotFormat.hpp). The file is memory-mapped: the header is read when the
+ * series is opened, and the values of any step and unknown are then accessed in
+ * place, without reading the other steps.
+ */
+struct SnapshotSeries
+{
+    std::unique_ptr<MappedFile> file;           /**< The mapped results file */
+
+    std::uint64_t meshHash = 0;                 /**< Hash of the .msh file */
+    std::uint64_t meshSize = 0;                 /**< Size of the .msh file */
+    std::size_t numNodes = 0;                   /**< Number of nodes (values per
+                                                     unknown) */
+    std::string problemType;                    /**< Equations solved */
+    std::vector<std::string> unknownNames;      /**< Name of each unknown */
+    std::vector<double> fluxCoeffs;             /**< Coefficients of the physical
+                                                     flux */
+    std::vector<std::size_t> elementTags;       /**< Tag of each element */
+    std::vector<unsigned int> elementNumNodes;  /**< Number of nodes of each
+                                                     element */
+
+    std::size_t nSteps = 0;                     /**< Number of complete steps */
+    const char* firstStep = nullptr;            /**< Record of the first step */
+    std::size_t stepSize = 0;                   /**< Size of a step record */
+};
+
+
+/**
+ * \brief Map a results file and read its header.
+ * \param fileName The name of the results file.
+ * \param series The time series.
+ * \return true if the file is a valid snapshot file, false otherwise.
+ */
+bool openSnapshotSeries(const std::string& fileName, SnapshotSeries& series);
+
+
+/**
+ * \brief Get the index of an unknown from its name.
+ * \param series The time series.
+ * \param name The name of the unknown.
+ * \return The index of the unknown, -1 if there is none with that name.
+ */
+int findSnapshotUnknown(const SnapshotSeries& series, const std::string& name);
+
+
+/**
+ * \brief Get the physical time of a step.
+ * \param series The time series.
+ * \param step Index of the step (in [0, nSteps)).
+ * \return The time of the step.
+ */
+double snapshotTime(const SnapshotSeries& series, std::size_t step);
+
+
+/**
+ * \brief Get the time step (of the solver) at which a step was written.
+ * \param series The time series.
+ * \param step Index of the step (in [0, nSteps)).
+ * \return The time step.
+ */
+unsigned int snapshotTimeStep(const SnapshotSeries& series, std::size_t step);
+
+
+/**
+ * \brief Get the nodal values of an unknown at a step, in the mapped file.
+ * \param series The time series.
+ * \param step Index of the step (in [0, nSteps)).
+ * \param unk Index of the unknown.
+ * \return Pointer to the numNodes values (valid as long as the series is open).
+ */
+const double* snapshotValues(const SnapshotSeries& series, std::size_t step,
+                             unsigned short unk);
+
+#endif /* snapshotReader_hpp_included */
@@ -0,0 +1,105 @@
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <gmsh.h>
+#include <Eigen/Dense>
+#include "snapshotReader.hpp"
+#include "write.hpp"
+#include "../physics/writers.hpp"
+
+/**
+ * Convert results in the binary snapshot format to gmsh views (with the
+ * quantities written by the physics writers), appended step after step to a .msh
+ * file which opens in gmsh as a time series.
+ * @param  argv[1] .msh file that contains the mesh used for the simulation.
+ * @param  argv[2] snapshot file that contains the results.
+ * @param  argv[3] name of the .msh file that will contain the results.
+ */
+int main(int argc, char **argv)
+{
+    if(argc < 4)
+    {
+        std::cerr   << "Usage: " << argv[0] << " file.msh " << " results.snap "
+                    << " results.msh" << std::endl;
+        return 1;
+    }
+
+    SnapshotSeries series;
+    if(!openSnapshotSeries(std::string(argv[2]), series))
+        return -1;
+
+    // check that the snapshots were computed on that mesh
+    MappedFile meshFile(argv[1]);
+    if(!meshFile.isOpen || meshFile.size != series.meshSize
+       || hashFile(meshFile) != series.meshHash)
+    {
+        std::cerr   << "The results in " << argv[2] << " were not computed on "
+                    << argv[1] << std::endl;
+        return -1;
+    }
+
+    // every quantity of the physics writer is written
+    std::function<void(std::vector<std::vector<double>>& uDisplay,
+                  const std::vector<unsigned int>& elementNumNodes,
+                  const std::vector<std::size_t>& elementTags,
+                  const std::string& modelName,unsigned int nbreStep, double t,
+                  const std::vector<Eigen::VectorXd>& u,
+                  const std::vector<double>& fluxCoeffs,
+                  const std::vector<bool>& whatToWrite,
+                  std::vector<int>& viewTags)> write;
+    unsigned int nViews = 5;
+    if(series.problemType == "shallow")
+        write = writeShallow;
+    else if(series.problemType == "shallowLin")
+        write = writeShallowLin;
+    else if(series.problemType == "AcousticLin")
+        write = writeAcousticLin;
+    else if(series.problemType == "transport")
+    {
+        write = writeTransport;
+        nViews = 1;
+    }
+    else
+    {
+        std::cerr   << "Unexpected problem type " << series.problemType
+                    << " in " << argv[2] << std::endl;
+        return -1;
+    }
+    std::vector<bool> whatToWrite(nViews, true);
+    std::vector<int> viewTags(nViews, -1);
+
+    gmsh::initialize();
+    gmsh::option::setNumber("General.Terminal", 1);
+    gmsh::open(argv[1]);
+    std::vector<std::string> names;
+    gmsh::model::list(names);
+    std::string modelName = names[0];
+
+    std::string resultsName(argv[3]);
+    std::remove(resultsName.c_str());
+
+    std::vector<std::vector<double>> uDisplay(series.elementNumNodes.size());
+    std::vector<Eigen::VectorXd> u(series.unknownNames.size());
+    for(std::size_t step = 0 ; step < series.nSteps ; ++step)
+    {
+        for(unsigned short unk = 0 ; unk < u.size() ; ++unk)
+        {
+            u[unk] = Eigen::Map<const Eigen::VectorXd>(
+                snapshotValues(series, step, unk), series.numNodes);
+        }
+
+        write(uDisplay, series.elementNumNodes, series.elementTags, modelName,
+              snapshotTimeStep(series, step), snapshotTime(series, step), u,
+              series.fluxCoeffs, whatToWrite, viewTags);
+        writeStep(viewTags, whatToWrite, resultsName);
+    }
+
+    gmsh::finalize();
+
+    std::cout   << series.nSteps << " steps written in " << resultsName
+                << std::endl;
+
+    return 0;
+}
@@ -10,3 +10,17 @@ void writeEnd(const std::vector<int>& viewTags, const std::vector<bool>& whatToW
             gmsh::view::write(viewTags[i], resultsName, true);
     }
 }
+
+void writeStep(std::vector<int>& viewTags, const std::vector<bool>& whatToWrite,
+               const std::string& resultsName)
+{
+    for(unsigned int i = 0 ; i < whatToWrite.size() ; ++i)
+    {
+        if(whatToWrite[i] == true)
+        {
+            gmsh::view::write(viewTags[i], resultsName, true);
+            gmsh::view::remove(viewTags[i]);
+            viewTags[i] = -1;
+        }
+    }
+}
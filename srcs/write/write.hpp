@@ -7,77 +7,26 @@
 
 
 /**
- * \brief Write data for shallow waters. You can write H, u, v, 0.*(u+v)
- * or the velocity field (boolean in whatToWrite).
- * \param uDisplay Vector (per element) of vector (per nodes) to write the data.
- * \param elementNumNodes Vector containg the number of nodes per element.
- * \param elementTags Vector containing the tag of all elements.
- * \param modelName Name of the model.
- * \param nbreStep Current time step.
- * \param t Current simulation physical time.
- * \param field Structure that contains all the main variables.
- * \param fluxCoeffs Coefficient of the physical flux.
- * \param whatToWrite Vector containing boolean describing which unknown to write.
- * \param viewTags Vector containing the rag of the different writing data's.
- */
-void writeShallow(std::vector<std::vector<double>>& uDisplay,
-                  const std::vector<unsigned int>& elementNumNodes,
-                  const std::vector<int>& elementTags, const std::string& modelName,
-                  unsigned int nbreStep, double t, const Field& field,
-                  const std::vector<double>& fluxCoeffs,
-                  const std::vector<bool>& whatToWrite, std::vector<int>& viewTags);
-
-
-/**
- * \brief Write data for linear shallow waters. You can write H, u, v, 0.*(u+v)
- * or the velocity field (boolean in whatToWrite).
- * \param uDisplay Vector (per element) of vector (per nodes) to write the data.
- * \param elementNumNodes Vector containg the number of nodes per element.
- * \param elementTags Vector containing the tag of all elements.
- * \param modelName Name of the model.
- * \param nbreStep Current time step.
- * \param t Current simulation physical time.
- * \param field Structure that contains all the main variables.
- * \param fluxCoeffs Coefficient of the physical flux.
- * \param whatToWrite Vector containing boolean describing which unknown to write.
+ * \brief Actually write the results file.
  * \param viewTags Vector containing the rag of the different writing data's.
- */
-void writeShallowLin(std::vector<std::vector<double>>& uDisplay,
-                  const std::vector<unsigned int>& elementNumNodes,
-                  const std::vector<int>& elementTags, const std::string& modelName,
-                  unsigned int nbreStep, double t, const Field& field,
-                  const std::vector<double>& fluxCoeffs,
-                  const std::vector<bool>& whatToWrite, std::vector<int>& viewTags);
-
-
-/**
- * \brief Write data for simple transport (boolean in whatToWrite).
- * \param uDisplay Vector (per element) of vector (per nodes) to write the data.
- * \param elementNumNodes Vector containg the number of nodes per element.
- * \param elementTags Vector containing the tag of all elements.
- * \param modelName Name of the model.
- * \param nbreStep Current time step.
- * \param t Current simulation physical time.
- * \param field Structure that contains all the main variables.
- * \param fluxCoeffs Coefficient of the physical flux.
  * \param whatToWrite Vector containing boolean describing which unknown to write.
- * \param viewTags Vector containing the rag of the different writing data's.
+ * \param resultsName the name of the .msh file that will contain the results
  */
-void writeTransport(std::vector<std::vector<double>>& uDisplay,
-                  const std::vector<unsigned int>& elementNumNodes,
-                  const std::vector<int>& elementTags, const std::string& modelName,
-                  unsigned int nbreStep, double t, const Field& field,
-                  const std::vector<double>& fluxCoeffs,
-                  const std::vector<bool>& whatToWrite, std::vector<int>& viewTags);
+void writeEnd(const std::vector<int>& viewTags, const std::vector<bool>& whatToWrite,
+                  const std::string& resultsName);
 
 
 /**
- * \brief Actually write the results file.
- * \param viewTags Vector containing the rag of the different writing data's.
+ * \brief Append the current step of the views to the results file, then remove
+ * the views so that only one step is kept in memory (streaming output). The
+ * writer creates them again at the next step with the same names, and gmsh reads
+ * the successive steps of the file as the time steps of each view.
+ * \param viewTags Vector containing the rag of the different writing data's
+ * (reset to -1 once the views are removed).
  * \param whatToWrite Vector containing boolean describing which unknown to write.
  * \param resultsName the name of the .msh file that will contain the results
  */
-void writeEnd(const std::vector<int>& viewTags, const std::vector<bool>& whatToWrite,
-                  const std::string& resultsName);
+void writeStep(std::vector<int>& viewTags, const std::vector<bool>& whatToWrite,
+               const std::string& resultsName);
 
 #endif /* write_hpp_included */